@@ -222,6 +222,16 @@ classes = {
                 args = {"string", "int", "int", "int", "int"},
                 rval = nil
             },
+            ter_rows = {
+                cpp_name = "draw_rows_ter",
+                args = {"int", "int", "string", "string"},
+                rval = nil
+            },
+            furn_rows = {
+                cpp_name = "draw_rows_furn",
+                args = {"int", "int", "string", "string"},
+                rval = nil
+            },
             rough_circle = {
                 cpp_name = "draw_rough_circle",
                 args = {"string", "int", "int", "int"},
@@ -1,16 +1,25 @@
 #include "active_item_cache.h"
 
-void active_item_cache::remove( std::list<item>::iterator it, point location )
+#include <algorithm>
+
+void active_item_cache::remove( std::list<item>::iterator it, point )
 {
-    active_items[it->processing_speed()].remove_if( [&] (const item_reference &active_item) {
-            return location == active_item.location && active_item.item_iterator == it; } );
-    active_item_set.erase( &*it );
+    const auto found = active_item_set.find( &*it );
+    if( found == active_item_set.end() ) {
+        return;
+    }
+    speed_bucket &bucket = active_items[found->second.first];
+    bucket.items[found->second.second].item_id = nullptr;
+    bucket.holes++;
+    active_item_set.erase( found );
 }
 
 void active_item_cache::add( std::list<item>::iterator it, point location )
 {
-    active_items[it->processing_speed()].push_back( item_reference{ location, it, &*it } );
-    active_item_set.insert( &*it );
+    const int speed = it->processing_speed();
+    speed_bucket &bucket = active_items[speed];
+    active_item_set[&*it] = std::make_pair( speed, bucket.items.size() );
+    bucket.items.push_back( item_reference{ location, it, &*it } );
 }
 
 bool active_item_cache::has( std::list<item>::iterator it, point ) const
@@ -20,30 +29,57 @@ bool active_item_cache::has( std::list<item>::iterator it, point ) const
 
 bool active_item_cache::has( item_reference const &itm ) const
 {
-    return active_item_set.count( itm.item_id ) != 0;
+    const auto found = active_item_set.find( itm.item_id );
+    if( found == active_item_set.end() ) {
+        return false;
+    }
+    // The item might have been removed and another one created at the same address.
+    const item_reference &current = active_items.at( found->second.first ).items[found->second.second];
+    return current.location == itm.location && current.item_iterator == itm.item_iterator;
 }
 
 bool active_item_cache::empty() const
 {
-    return active_items.empty();
+    return active_item_set.empty();
+}
+
+void active_item_cache::compact( int speed, speed_bucket &bucket )
+{
+    size_t next = 0;
+    for( auto &elem : bucket.items ) {
+        if( elem.item_id == nullptr ) {
+            continue;
+        }
+        active_item_set[elem.item_id] = std::make_pair( speed, next );
+        bucket.items[next++] = elem;
+    }
+    bucket.items.resize( next );
+    bucket.holes = 0;
 }
 
-// get() only returns the first size() / processing_speed() elements of each list, rounded up.
+// get() only returns the first size() / processing_speed() elements of each bucket, rounded up.
 // It relies on the processing logic to remove and reinsert the items to they
-// move to the back of their respective lists (or to new lists).
+// move to the back of their respective buckets (or to new buckets).
 // Otherwise only the first n items will ever be processed.
-std::list<item_reference> active_item_cache::get()
+void active_item_cache::get( std::vector<item_reference> &items_to_process )
 {
-    std::list<item_reference> items_to_process;
+    items_to_process.clear();
     for( auto &tuple : active_items ) {
-        // Rely on iteration logic to make sure the number is sane.
-        int num_to_process = tuple.second.size() / tuple.first;
-        for( auto &an_iter : tuple.second ) {
-            items_to_process.push_back( an_iter );
-            if( --num_to_process < 0 ) {
+        speed_bucket &bucket = tuple.second;
+        // Compacting once the bucket is half holes keeps it amortized O(1) per removal.
+        if( bucket.holes > 0 && bucket.holes * 2 >= bucket.items.size() ) {
+            compact( tuple.first, bucket );
+        }
+        const size_t speed = std::max( tuple.first, 1 );
+        size_t num_to_process = ( bucket.items.size() - bucket.holes + speed - 1 ) / speed;
+        for( auto &an_iter : bucket.items ) {
+            if( num_to_process == 0 ) {
                 break;
             }
+            if( an_iter.item_id != nullptr ) {
+                items_to_process.push_back( an_iter );
+                num_to_process--;
+            }
         }
     }
-    return items_to_process;
 }
@@ -5,7 +5,7 @@
 #include "item.h"
 #include <list>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 // A struct used to uniquely identify an item within a submap or vehicle.
 struct item_reference
@@ -19,9 +19,19 @@ struct item_reference
 class active_item_cache
 {
 private:
-    std::unordered_map<int, std::list<item_reference>> active_items;
-    // Cache for fast lookup when we're iterating over the active items to verify the item is present.
-    std::unordered_set<item *> active_item_set;
+    // All active items with the same processing speed, in the order they are processed.
+    // Removed items are left as holes (item_id is null) and compacted away by get(),
+    // this keeps removal O(1) and keeps the order intact.
+    struct speed_bucket {
+        std::vector<item_reference> items;
+        size_t holes = 0;
+    };
+    std::unordered_map<int, speed_bucket> active_items;
+    // Speed and index in the bucket of each active item, for fast removal and for
+    // verifying the item is still present while we're iterating over the active items.
+    std::unordered_map<const item *, std::pair<int, size_t>> active_item_set;
+
+    void compact( int speed, speed_bucket &bucket );
 
 public:
     void remove( std::list<item>::iterator it, point location );
@@ -30,7 +40,11 @@ public:
     // Use this one if there's a chance that the item being referenced has been invalidated.
     bool has( item_reference const &itm ) const;
     bool empty() const;
-    std::list<item_reference> get();
+    /**
+     * Fills items_to_process with the items that should be processed this turn.
+     * The vector is cleared first, callers should reuse it to avoid reallocating it.
+     */
+    void get( std::vector<item_reference> &items_to_process );
 };
 
 #endif
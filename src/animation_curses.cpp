@@ -4,6 +4,10 @@
 bool is_valid_in_w_terrain(int x, int y);
 
 #include "game.h"
+
+#include <algorithm>
+#include <map>
+
 /* Explosion Animation */
 void game::draw_explosion(int x, int y, int radius, nc_color col)
 {
@@ -60,6 +64,48 @@ void game::draw_bullet(Creature &p, int tx, int ty, int i, std::vector<point> tr
         }
     }
 }
+/* Shrapnel Animation */
+void game::draw_shrapnel( const std::vector<std::vector<point>> &fragments )
+{
+    timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = 1000000 * OPTIONS["ANIMATION_DELAY"];
+    size_t steps = 0;
+    for( const auto &traj : fragments ) {
+        steps = std::max( steps, traj.size() );
+    }
+    // Most fragments share the squares near the origin.
+    std::map<point, bool> visible;
+    const auto sees = [&]( const point &p ) {
+        const auto iter = visible.find( p );
+        if( iter != visible.end() ) {
+            return iter->second;
+        }
+        return visible[p] = u.sees( p.x, p.y );
+    };
+    for( size_t i = 0; i < steps; i++ ) {
+        bool drawn = false;
+        for( const auto &traj : fragments ) {
+            if( i >= traj.size() || !sees( traj[i] ) ) {
+                continue;
+            }
+            if( i > 0 ) {
+                m.drawsq(w_terrain, u, traj[i - 1].x, traj[i - 1].y, false,
+                         true, u.posx() + u.view_offset_x, u.posy() + u.view_offset_y);
+            }
+            mvwputch(w_terrain, POSY + (traj[i].y - (u.posy() + u.view_offset_y)),
+                     POSX + (traj[i].x - (u.posx() + u.view_offset_x)), c_red, '`');
+            drawn = true;
+        }
+        if( !drawn ) {
+            continue;
+        }
+        wrefresh(w_terrain);
+        if( ts.tv_nsec != 0 ) {
+            nanosleep(&ts, NULL);
+        }
+    }
+}
 /* Monster hit animation */
 void game::draw_hit_mon(int x, int y, const monster &m, bool dead)
 {
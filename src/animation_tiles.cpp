@@ -4,6 +4,9 @@
 #include "debug.h"
 #include "cata_tiles.h" // all animation functions will be pushed out to a cata_tiles function in some manner
 
+#include <algorithm>
+#include <map>
+
 extern cata_tiles *tilecontext; // obtained from sdltiles.cpp
 extern void try_update();
 
@@ -78,6 +81,52 @@ void game::draw_bullet(Creature &p, int tx, int ty, int i,
         tilecontext->void_bullet();
     }
 }
+/* Tiles version of Shrapnel Animation */
+void game::draw_shrapnel( const std::vector<std::vector<point>> &fragments )
+{
+    timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = 1000000 * OPTIONS["ANIMATION_DELAY"];
+    size_t steps = 0;
+    for( const auto &traj : fragments ) {
+        steps = std::max( steps, traj.size() );
+    }
+    // Most fragments share the squares near the origin.
+    std::map<point, bool> visible;
+    const auto sees = [&]( const point &p ) {
+        const auto iter = visible.find( p );
+        if( iter != visible.end() ) {
+            return iter->second;
+        }
+        return visible[p] = u.sees( p.x, p.y );
+    };
+    std::vector<point> drawn;
+    for( size_t i = 0; i < steps; i++ ) {
+        drawn.clear();
+        for( const auto &traj : fragments ) {
+            if( i >= traj.size() || !sees( traj[i] ) ) {
+                continue;
+            }
+            if( !use_tiles ) {
+                mvwputch(w_terrain, POSY + (traj[i].y - (u.posy() + u.view_offset_y)),
+                         POSX + (traj[i].x - (u.posx() + u.view_offset_x)), c_red, '`');
+            }
+            drawn.push_back( traj[i] );
+        }
+        if( drawn.empty() ) {
+            continue;
+        }
+        if( use_tiles ) {
+            tilecontext->init_draw_bullets( drawn, "animation_bullet_shrapnel" );
+        }
+        wrefresh(w_terrain);
+        try_update();
+        if( ts.tv_nsec != 0 ) {
+            nanosleep(&ts, NULL);
+        }
+    }
+    tilecontext->void_bullet();
+}
 /* Monster hit animation */
 void game::draw_hit_mon(int x, int y, const monster &m, bool dead)
 {
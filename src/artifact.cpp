@@ -1246,6 +1246,7 @@ bool save_artifacts( const std::string &path )
         }
 
         JsonOut json( fout );
+        json.reserve_buffer();
         json.start_array();
         for( auto & p : item_controller->get_all_itypes() ) {
             it_artifact_tool *art_tool = dynamic_cast<it_artifact_tool *>( p.second );
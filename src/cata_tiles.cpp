@@ -1219,8 +1219,13 @@ void cata_tiles::init_explosion(int x, int y, int radius)
 void cata_tiles::init_draw_bullet(int x, int y, std::string name)
 {
     do_draw_bullet = true;
-    bul_pos_x = x;
-    bul_pos_y = y;
+    bul_positions.assign( 1, point( x, y ) );
+    bul_id = name;
+}
+void cata_tiles::init_draw_bullets(const std::vector<point> &ps, std::string name)
+{
+    do_draw_bullet = true;
+    bul_positions = ps;
     bul_id = name;
 }
 void cata_tiles::init_draw_hit(int x, int y, std::string name)
@@ -1267,8 +1272,7 @@ void cata_tiles::void_explosion()
 void cata_tiles::void_bullet()
 {
     do_draw_bullet = false;
-    bul_pos_x = -1;
-    bul_pos_y = -1;
+    bul_positions.clear();
     bul_id = "";
 }
 void cata_tiles::void_hit()
@@ -1331,9 +1335,9 @@ void cata_tiles::draw_explosion_frame()
 }
 void cata_tiles::draw_bullet_frame()
 {
-    const int mx = bul_pos_x, my = bul_pos_y;
-
-    draw_from_id_string(bul_id, C_BULLET, empty_string, mx, my, 0, 0);
+    for( const point &p : bul_positions ) {
+        draw_from_id_string(bul_id, C_BULLET, empty_string, p.x, p.y, 0, 0);
+    }
 }
 void cata_tiles::draw_hit_frame()
 {
@@ -244,6 +244,8 @@ class cata_tiles
         void void_explosion();
 
         void init_draw_bullet(int x, int y, std::string name);
+        /** Like init_draw_bullet, but shows a bullet on each of the points at once. */
+        void init_draw_bullets(const std::vector<point> &ps, std::string name);
         void draw_bullet_frame();
         void void_bullet();
 
@@ -311,7 +313,7 @@ class cata_tiles
 
         int exp_pos_x, exp_pos_y, exp_rad;
 
-        int bul_pos_x, bul_pos_y;
+        std::vector<point> bul_positions;
         std::string bul_id;
 
         int hit_pos_x, hit_pos_y;
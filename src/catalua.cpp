@@ -142,36 +142,60 @@ void lua_callback(lua_State *, const char *callback_name)
     call_lua(std::string("mod_callback(\"") + std::string(callback_name) + "\")");
 }
 
-//
-int lua_mapgen(map *m, std::string terrain_type, mapgendata, int t, float, const std::string &scr)
+int lua_mapgen_compile( const std::string &scr )
 {
     if( lua_state == nullptr ) {
         return 0;
     }
     lua_State *L = lua_state;
-    {
-        map **map_userdata = (map **) lua_newuserdata(L, sizeof(map *));
-        *map_userdata = m;
-        luah_setmetatable(L, "map_metatable");
-        luah_setglobal(L, "map", -1);
+    const int err = luaL_loadstring( L, scr.c_str() );
+    if( lua_report_error( L, err, scr.c_str() ) ) {
+        lua_pop( L, 1 );
+        return 0;
     }
+    // Pops the compiled chunk. References are always positive, 0 is never returned.
+    return luaL_ref( L, LUA_REGISTRYINDEX );
+}
 
-    int err = luaL_loadstring(L, scr.c_str() );
-    if( lua_report_error( L, err, scr.c_str() ) ) {
-        return err;
+void lua_mapgen_release( int function_ref )
+{
+    if( lua_state != nullptr && function_ref != 0 ) {
+        luaL_unref( lua_state, LUA_REGISTRYINDEX, function_ref );
+    }
+}
+
+//
+int lua_mapgen(map *m, std::string terrain_type, mapgendata, int t, float, int function_ref,
+               const std::string &scr)
+{
+    if( lua_state == nullptr || function_ref == 0 ) {
+        return 0;
     }
-    //    int function_index = luaL_ref(L, LUA_REGISTRYINDEX); // todo; make use of this
-    //    lua_rawgeti(L, LUA_REGISTRYINDEX, function_index);
+    lua_State *L = lua_state;
+    // The map userdata is only created once, it's pointed at the map to generate on each call.
+    static int map_userdata_ref = LUA_NOREF;
+    if( map_userdata_ref == LUA_NOREF ) {
+        lua_newuserdata(L, sizeof(map *));
+        luah_setmetatable(L, "map_metatable");
+        map_userdata_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+    lua_rawgeti(L, LUA_REGISTRYINDEX, map_userdata_ref);
+    *static_cast<map **>( lua_touserdata(L, -1) ) = m;
+    luah_setglobal(L, "map", -1);
 
     lua_pushstring(L, terrain_type.c_str());
-    lua_setglobal(L, "tertype");
+    luah_setglobal(L, "tertype", -1);
     lua_pushinteger(L, t);
-    lua_setglobal(L, "turn");
-
-    err = lua_pcall(L, 0 , LUA_MULTRET, 0);
-    lua_report_error( L, err, scr.c_str() );
+    luah_setglobal(L, "turn", -1);
 
-    //    luah_remove_from_registry(L, function_index); // todo: make use of this
+    // The globals are kept for existing scripts, the script also gets the same values as
+    // arguments: local map, tertype, turn = ...
+    lua_rawgeti(L, LUA_REGISTRYINDEX, function_ref);
+    lua_insert(L, -4);
+    const int err = lua_pcall(L, 3, 0, 0);
+    if( lua_report_error( L, err, scr.c_str() ) ) {
+        lua_pop(L, 1);
+    }
 
     return err;
 }
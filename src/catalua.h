@@ -23,7 +23,19 @@ int lua_monster_move(monster *m);
  * Call the given string as lua code, used for interactive debugging.
  */
 int call_lua(std::string tocall);
-int lua_mapgen(map *m, std::string terrain_type, mapgendata md, int t, float d,
+/**
+ * Compiles a lua mapgen script once, the result is passed to @ref lua_mapgen.
+ * @return Registry reference of the compiled script, or 0 if it could not be compiled
+ * (the error has been reported).
+ */
+int lua_mapgen_compile( const std::string &scr );
+/** Releases a script compiled by @ref lua_mapgen_compile. */
+void lua_mapgen_release( int function_ref );
+/**
+ * Runs a compiled mapgen script on the given map. scr is the source of the script, it's only
+ * used in error messages.
+ */
+int lua_mapgen(map *m, std::string terrain_type, mapgendata md, int t, float d, int function_ref,
                const std::string &scr);
 
 /**
@@ -6,6 +6,9 @@
 #include "inventory.h"
 
 #include <map>
+#include <vector>
+
+class trait_id;
 
 class Character : public Creature
 {
@@ -47,6 +50,8 @@ class Character : public Creature
         // In mutation.cpp
         /** Returns true if the player has the entered trait */
         virtual bool has_trait(const std::string &flag) const;
+        /** Same as above, but without looking up the string id, see @ref trait_id */
+        bool has_trait( const trait_id &trait ) const;
         /** Returns true if the player has the entered starting trait */
         bool has_base_trait(const std::string &flag) const;
         /** Returns the trait id with the given invlet, or an empty string if no trait has that invlet */
@@ -345,6 +350,13 @@ class Character : public Creature
          * Contains mutation ids of the base traits.
          */
         std::unordered_set<std::string> my_traits;
+        /**
+         * Bit i is set if @ref my_mutations contains the mutation whose @ref trait_id has
+         * the index i.
+         */
+        std::vector<bool> trait_bits;
+        /** Must be called whenever entries are added to or removed from @ref my_mutations. */
+        void update_trait_bits();
         std::vector<bionic> my_bionics;
 
         void store(JsonOut &jsout) const;
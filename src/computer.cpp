@@ -34,6 +34,11 @@ computer::computer(std::string Name, int Security): name(Name)
     mission_id = -1;
 }
 
+computer::computer(const computer &rhs): computer()
+{
+    *this = rhs;
+}
+
 computer::~computer()
 {
     if (w_terminal != NULL) {
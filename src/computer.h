@@ -87,6 +87,7 @@ class computer
     public:
         computer();
         computer(std::string Name, int Security);
+        computer(const computer &rhs);
         ~computer();
 
         computer &operator=(const computer &rhs);
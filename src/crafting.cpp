@@ -1580,7 +1580,7 @@ void player::complete_craft()
             // Setting this for items counted by charges gives only problems:
             // those items are automatically merged everywhere (map/vehicle/inventory),
             // which would either loose this information or merge it somehow.
-            newit.components.insert(newit.components.begin(), used.begin(), used.end());
+            newit.edit_components().insert( newit.edit_components().begin(), used.begin(), used.end() );
         }
         finalize_crafted_item( newit, used_age_tally, used_age_count );
         set_item_inventory(newit);
@@ -1997,7 +1997,7 @@ void player::disassemble(int dis_pos)
 item_comp find_component( const std::vector<item_comp> &altercomps, const item &dis_item )
 {
     for( auto & comp : altercomps ) {
-        for( auto & elem : dis_item.components ) {
+        for( auto & elem : dis_item.get_components() ) {
             if( elem.typeId() == comp.type ) {
                 return comp;
             }
@@ -2119,11 +2119,12 @@ void player::complete_disassemble()
             // Use item from components list, or (if not contained)
             // use newit, the default constructed.
             item act_item = newit;
-            for(item::t_item_vector::iterator a = dis_item.components.begin(); a != dis_item.components.end();
+            item::t_item_vector &components = dis_item.edit_components();
+            for(item::t_item_vector::iterator a = components.begin(); a != components.end();
                 ++a) {
                 if (a->type == newit.type) {
                     act_item = *a;
-                    dis_item.components.erase(a);
+                    components.erase(a);
                     break;
                 }
             }
@@ -2,6 +2,13 @@
 #include "mongroup.h"
 #include "output.h"
 #include "debug.h"
+#include "map.h"
+#include "overmap.h"
+
+#include <algorithm>
+
+static const int GRID_WIDTH = SEEX * MAPSIZE;
+static const int GRID_HEIGHT = SEEY * MAPSIZE;
 
 Creature_tracker::Creature_tracker()
 {
@@ -24,14 +31,74 @@ monster &Creature_tracker::find(int index)
     return *(monsters_list[index]);
 }
 
+static bool in_grid( const tripoint &coords )
+{
+    return coords.x >= 0 && coords.x < GRID_WIDTH && coords.y >= 0 && coords.y < GRID_HEIGHT &&
+           coords.z >= -OVERMAP_DEPTH && coords.z <= OVERMAP_HEIGHT;
+}
+
+int *Creature_tracker::grid_cell( const tripoint &coords )
+{
+    if( !in_grid( coords ) ) {
+        return nullptr;
+    }
+    if( monsters_grid.empty() ) {
+        monsters_grid.resize( OVERMAP_LAYERS );
+    }
+    auto &level = monsters_grid[coords.z + OVERMAP_DEPTH];
+    if( level.empty() ) {
+        level.assign( GRID_WIDTH * GRID_HEIGHT, -1 );
+    }
+    return &level[coords.x + coords.y * GRID_WIDTH];
+}
+
+const int *Creature_tracker::grid_cell( const tripoint &coords ) const
+{
+    static const int no_monster = -1;
+    if( !in_grid( coords ) ) {
+        return nullptr;
+    }
+    if( monsters_grid.empty() || monsters_grid[coords.z + OVERMAP_DEPTH].empty() ) {
+        // Nothing has been placed on this level yet.
+        return &no_monster;
+    }
+    return &monsters_grid[coords.z + OVERMAP_DEPTH][coords.x + coords.y * GRID_WIDTH];
+}
+
+int Creature_tracker::location_entry( const tripoint &coords ) const
+{
+    const int *cell = grid_cell( coords );
+    if( cell != nullptr ) {
+        return *cell;
+    }
+    const auto iter = monsters_outside_grid.find( coords );
+    return iter == monsters_outside_grid.end() ? -1 : (int)iter->second;
+}
+
+void Creature_tracker::set_location_entry( const tripoint &coords, int index )
+{
+    int *cell = grid_cell( coords );
+    if( cell != nullptr ) {
+        *cell = index;
+    } else {
+        monsters_outside_grid[coords] = index;
+    }
+}
+
+void Creature_tracker::clear_location_entry( const tripoint &coords )
+{
+    if( in_grid( coords ) ) {
+        *grid_cell( coords ) = -1;
+    } else {
+        monsters_outside_grid.erase( coords );
+    }
+}
+
 int Creature_tracker::mon_at( const tripoint &coords ) const
 {
-    const auto iter = monsters_by_location.find( coords );
-    if( iter != monsters_by_location.end() ) {
-        const int critter_id = iter->second;
-        if( !monsters_list[critter_id]->is_dead() ) {
-            return (int)critter_id;
-        }
+    const int critter_id = location_entry( coords );
+    if( critter_id >= 0 && !monsters_list[critter_id]->is_dead() ) {
+        return critter_id;
     }
 
     return -1;
@@ -53,7 +120,7 @@ bool Creature_tracker::add( monster &critter )
         return false;
     }
 
-    monsters_by_location[critter.pos3()] = monsters_list.size();
+    set_location_entry( critter.pos3(), monsters_list.size() );
     monsters_list.push_back(new monster(critter));
     return true;
 }
@@ -68,7 +135,7 @@ bool Creature_tracker::update_pos(const monster &critter, const tripoint &new_po
     const auto old_pos = critter.pos3();
     if( critter.is_dead() ) {
         // mon_at ignores dead critters anyway, changing their position in the
-        // monsters_by_location map is useless.
+        // location cache is useless.
         remove_from_location_map( critter );
         return true;
     }
@@ -81,8 +148,8 @@ bool Creature_tracker::update_pos(const monster &critter, const tripoint &new_po
                  new_pos.x, new_pos.y, new_pos.z, new_critter_id);
     } else if( critter_id >= 0 ) {
         if( &critter == monsters_list[critter_id] ) {
-            monsters_by_location.erase( old_pos );
-            monsters_by_location[new_pos] = critter_id;
+            clear_location_entry( old_pos );
+            set_location_entry( new_pos, critter_id );
             success = true;
         } else {
             debugmsg("update_zombie_pos: old location %d,%d had zombie %d instead",
@@ -90,7 +157,7 @@ bool Creature_tracker::update_pos(const monster &critter, const tripoint &new_po
         }
     } else {
         // We're changing the x/y/z coordinates of a zombie that hasn't been added
-        // to the game yet. add_zombie() will update monsters_by_location for us.
+        // to the game yet. add_zombie() will update the location cache for us.
         debugmsg("update_zombie_pos: no such zombie at %d,%d,%d (moving to %d,%d,%d)",
                  old_pos.x, old_pos.y, old_pos.z, new_pos.x, new_pos.y, new_pos.z );
         // Rebuild cache in case the monster actually IS in the game, just bugged
@@ -103,12 +170,9 @@ bool Creature_tracker::update_pos(const monster &critter, const tripoint &new_po
 void Creature_tracker::remove_from_location_map( const monster &critter )
 {
     const tripoint &loc = critter.pos3();
-    const auto pos_iter = monsters_by_location.find( loc );
-    if( pos_iter != monsters_by_location.end() ) {
-        const auto &other = find( pos_iter->second );
-        if( &other == &critter ) {
-            monsters_by_location.erase( pos_iter );
-        }
+    const int critter_id = location_entry( loc );
+    if( critter_id >= 0 && &find( critter_id ) == &critter ) {
+        clear_location_entry( loc );
     }
 }
 
@@ -126,10 +190,11 @@ void Creature_tracker::remove( const int idx )
     delete monsters_list[idx];
     monsters_list.erase( monsters_list.begin() + idx );
 
-    // Fix indices in monsters_by_location for any zombies that were just moved down 1 place.
-    for( auto &elem : monsters_by_location ) {
-        if( elem.second > (size_t)idx ) {
-            --elem.second;
+    // Fix the cached indices of the zombies that were just moved down 1 place.
+    for( size_t i = idx; i < monsters_list.size(); i++ ) {
+        const tripoint &loc = monsters_list[i]->pos3();
+        if( location_entry( loc ) == (int)i + 1 ) {
+            set_location_entry( loc, i );
         }
     }
 }
@@ -140,15 +205,23 @@ void Creature_tracker::clear()
         delete monster_ptr;
     }
     monsters_list.clear();
-    monsters_by_location.clear();
+    clear_location_cache();
+}
+
+void Creature_tracker::clear_location_cache()
+{
+    for( auto &level : monsters_grid ) {
+        std::fill( level.begin(), level.end(), -1 );
+    }
+    monsters_outside_grid.clear();
 }
 
 void Creature_tracker::rebuild_cache()
 {
-    monsters_by_location.clear();
+    clear_location_cache();
     for( size_t i = 0; i < monsters_list.size(); i++ ) {
         monster &critter = *monsters_list[i];
-        monsters_by_location[critter.pos3()] = i;
+        set_location_entry( critter.pos3(), i );
     }
 }
 
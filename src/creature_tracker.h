@@ -30,8 +30,22 @@ class Creature_tracker
 
     private:
         std::vector<monster *> monsters_list;
-        std::unordered_map<tripoint, size_t> monsters_by_location;
-        /** Remove the monsters entry in @ref monsters_by_location */
+        /**
+         * Index of the monster on each tile of the reality bubble, one grid per z-level
+         * (allocated when the first monster is placed on that level), -1 for no monster.
+         * Monsters outside of the reality bubble are in @ref monsters_outside_grid.
+         */
+        std::vector<std::vector<int>> monsters_grid;
+        std::unordered_map<tripoint, size_t> monsters_outside_grid;
+        /** Returns the grid cell of the location, or nullptr if it's outside of the grid. */
+        int *grid_cell( const tripoint &coords );
+        const int *grid_cell( const tripoint &coords ) const;
+        /** Index stored for the location, or -1 if there is none. */
+        int location_entry( const tripoint &coords ) const;
+        void set_location_entry( const tripoint &coords, int index );
+        void clear_location_entry( const tripoint &coords );
+        void clear_location_cache();
+        /** Remove the monsters entry in the location cache */
         void remove_from_location_map( const monster &critter );
 };
 
@@ -32,12 +32,43 @@ static int debugClass = D_MAIN;
 
 bool debug_mode = false;
 
+// Where the debug output of this thread goes, it is shown and logged if this is null.
+static thread_local debugmsg_collector *current_collector = nullptr;
+
+debugmsg_collector::debugmsg_collector( std::vector<std::string> &messages, std::string &log )
+    : messages( messages )
+    , log( log )
+    // Without a buffer the stream discards everything.
+    , null_stream( nullptr )
+    , previous( current_collector )
+{
+    current_collector = this;
+}
+
+debugmsg_collector::~debugmsg_collector()
+{
+    log += log_stream.str();
+    current_collector = previous;
+}
+
+void show_debugmsgs( const std::vector<std::string> &messages )
+{
+    for( auto &message : messages ) {
+        debugmsg( "%s", message.c_str() );
+    }
+}
+
 void realDebugmsg( const char *filename, const char *line, const char *mes, ... )
 {
     va_list ap;
     va_start( ap, mes );
     const std::string text = vstring_format( mes, ap );
     va_end( ap );
+    if( current_collector != nullptr ) {
+        // The message is logged when it's shown, so the location goes along with it.
+        current_collector->messages.push_back( std::string( filename ) + ":" + line + " " + text );
+        return;
+    }
     DebugLog( D_ERROR, D_MAIN ) << filename << ":" << line << " " << text;
     fold_and_print( stdscr, 0, 0, getmaxx( stdscr ), c_ltred, "DEBUG: %s\n  Press spacebar...",
                     text.c_str() );
@@ -297,7 +328,17 @@ std::ostream &DebugLog( DebugLevel lev, DebugClass cl )
 {
     // Error are always logged, they are important,
     // Messages from D_MAIN come from debugmsg and are equally important.
-    if( ( ( lev & debugLevel ) && ( cl & debugClass ) ) || lev & D_ERROR || cl & D_MAIN ) {
+    const bool logged = ( ( lev & debugLevel ) && ( cl & debugClass ) ) || lev & D_ERROR ||
+                        cl & D_MAIN;
+    if( current_collector != nullptr ) {
+        // Not on the main thread, the entry is written by write_debug_log later on.
+        if( !logged ) {
+            return current_collector->null_stream;
+        }
+        current_collector->log_stream << std::endl << lev << cl << ": ";
+        return current_collector->log_stream;
+    }
+    if( logged ) {
         debugFile.file << std::endl;
         debugFile.currentTime() << " ";
         if( lev != debugLevel ) {
@@ -326,4 +367,11 @@ std::ostream &DebugLog( DebugLevel lev, DebugClass cl )
     return nullStream;
 }
 
+void write_debug_log( const std::string &log )
+{
+    if( !log.empty() ) {
+        debugFile.file << log;
+    }
+}
+
 // vim:tw=72:sw=1:fdm=marker:fdl=0:
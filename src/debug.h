@@ -42,6 +42,8 @@
 // Includes                                                         {{{1
 // ---------------------------------------------------------------------
 #include <iostream>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #define STRING2(x) #x
@@ -121,6 +123,36 @@ void limitDebugClass( int );
 // See documentation at the top.
 std::ostream &DebugLog( DebugLevel, DebugClass );
 
+/**
+ * While an object of this class exists, debug messages from the thread that created it are
+ * not shown but added to the given vector, and what the thread writes to DebugLog goes to the
+ * given string instead of the debug log. Showing them needs the screen and writing to the log
+ * isn't thread safe, code running on another thread hands them to the main thread with this,
+ * which passes them on with @ref show_debugmsgs and @ref write_debug_log.
+ */
+class debugmsg_collector
+{
+    public:
+        debugmsg_collector( std::vector<std::string> &messages, std::string &log );
+        ~debugmsg_collector();
+        debugmsg_collector( const debugmsg_collector & ) = delete;
+        debugmsg_collector &operator=( const debugmsg_collector & ) = delete;
+    private:
+        std::vector<std::string> &messages;
+        std::string &log;
+        std::ostringstream log_stream;
+        std::ostream null_stream;
+        debugmsg_collector *previous;
+
+        friend void realDebugmsg( const char *name, const char *line, const char *mes, ... );
+        friend std::ostream &DebugLog( DebugLevel, DebugClass );
+};
+
+/** Shows the messages collected by a @ref debugmsg_collector, one after the other. */
+void show_debugmsgs( const std::vector<std::string> &messages );
+/** Writes the DebugLog output collected by a @ref debugmsg_collector to the debug log. */
+void write_debug_log( const std::string &log );
+
 // OStream operators                                                {{{1
 // ---------------------------------------------------------------------
 
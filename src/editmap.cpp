@@ -1678,32 +1678,21 @@ int editmap::mapgen_preview( real_coords &tc, uimenu &gmenu )
                                 spawns_todo++;
                             }
 
-                            for ( int sx = 0; sx < 12; sx++ ) { // copy fields
-                                for ( int sy = 0; sy < 12; sy++ ) {
-                                    destsm->fld[sx][sy] = srcsm->fld[sx][sy];
-                                }
-                            }
+                            destsm->tile_fields = srcsm->tile_fields; // copy fields
                             destsm->field_count = srcsm->field_count; // and count
 
-                            memcpy( *destsm->ter, srcsm->ter, sizeof(srcsm->ter) ); // terrain
-                            memcpy( *destsm->frn, srcsm->frn, sizeof(srcsm->frn) ); // furniture
-                            memcpy( *destsm->trp, srcsm->trp, sizeof(srcsm->trp) ); // traps
-                            memcpy( *destsm->rad, srcsm->rad, sizeof(srcsm->rad) ); // radiation
-                            memcpy( *destsm->lum, srcsm->lum, sizeof(srcsm->lum) ); // emissive items
-                            for (int x = 0; x < SEEX; ++x) {
-                                for (int y = 0; y < SEEY; ++y) {
-                                    destsm->itm[x][y].swap( srcsm->itm[x][y] );
-                                    destsm->cosmetics[x][y].swap( srcsm->cosmetics[x][y] );
-                                }
-                            }
+                            // terrain, furniture, traps, radiation, emissive items (copied on write)
+                            destsm->tiles = srcsm->tiles;
+                            destsm->tile_items.swap( srcsm->tile_items );
+                            destsm->tile_cosmetics.swap( srcsm->tile_cosmetics );
 
                             // various misc variables
                             destsm->active_items = srcsm->active_items;
 
                             destsm->temperature = srcsm->temperature;
                             destsm->turn_last_touched = int(calendar::turn);
-                            destsm->comp = srcsm->comp;
-                            destsm->camp = srcsm->camp;
+                            destsm->comp.reset( srcsm->comp ? new computer( *srcsm->comp ) : nullptr );
+                            destsm->camp.reset( srcsm->camp ? new basecamp( *srcsm->camp ) : nullptr );
 
                             if ( spawns_todo > 0 ) {                              // trigger spawnpoints
                                 g->m.spawn_monsters( true );
@@ -1883,7 +1872,6 @@ void editmap::cleartmpmap( tinymap & tmpmap ) {
         delete smap;
     }
 
-    memset(tmpmap.veh_exists_at, 0, sizeof(tmpmap.veh_exists_at));
-    tmpmap.veh_cached_parts.clear();
+    tmpmap.clear_vehicle_cache();
     tmpmap.vehicle_list.clear();
 }
@@ -413,18 +413,27 @@ bool map::process_fields()
  for (int x = 0; x < my_MAPSIZE; x++) {
   for (int y = 0; y < my_MAPSIZE; y++) {
    submap * const current_submap = get_submap_at_grid(x, y);
-   if (current_submap->field_count > 0)
+   if (current_submap->field_count > 0) {
     found_field |= process_fields_in_submap(current_submap, x, y);
+    // For now, just always dirty the transparency cache
+    // when a field might possibly be changed.
+    // TODO: check if there are any fields(mostly fire)
+    //       that frequently change, if so set the dirty
+    //       flag, otherwise only set the dirty flag if
+    //       something actually changed
+    set_transparency_cache_dirty( x, y );
+   }
   }
  }
  if (found_field) {
-     // For now, just always dirty the transparency cache
-     // when a field might possibly be changed.
-     // TODO: check if there are any fields(mostly fire)
-     //       that frequently change, if so set the dirty
-     //       flag, otherwise only set the dirty flag if
-     //       something actually changed
-     set_transparency_cache_dirty();
+     // Fields may have spread into submaps that had none before.
+     for (int x = 0; x < my_MAPSIZE; x++) {
+         for (int y = 0; y < my_MAPSIZE; y++) {
+             if( get_submap_at_grid( x, y )->field_count > 0 ) {
+                 set_transparency_cache_dirty( x, y );
+             }
+         }
+     }
  }
  return found_field;
 }
@@ -454,9 +463,14 @@ bool map::process_fields_in_submap( submap *const current_submap,
             // All submaps are in one long 1d array.
             int x = locx + submap_x * SEEX;
             int y = locy + submap_y * SEEY;
+            // Only look at squares that have fields, looking them up in the non-const
+            // submap would add an empty field to every square.
+            if( static_cast<const submap *>( current_submap )->get_field( locx, locy ).fieldCount() == 0 ) {
+                continue;
+            }
             // get a copy of the field variable from the submap;
             // contains all the pointers to the real field effects.
-            field &curfield = current_submap->fld[locx][locy];
+            field &curfield = current_submap->get_field( locx, locy );
             for( auto it = curfield.begin(); it != curfield.end();) {
                 //Iterating through all field effects in the submap's field.
                 field_entry * cur = &it->second;
@@ -1397,7 +1411,7 @@ bool map::process_fields_in_submap( submap *const current_submap,
                     }
                     if (should_dissipate == true || !cur->isAlive()) { // Totally dissapated.
                         current_submap->field_count--;
-                        it = current_submap->fld[locx][locy].removeField(cur->getFieldType());
+                        it = curfield.removeField(cur->getFieldType());
                         continue;
                     }
                 }
@@ -52,6 +52,7 @@
 #include "npc.h"
 #include "scenario.h"
 #include "mission.h"
+#include "turn_profiler.h"
 
 #include <map>
 #include <set>
@@ -226,6 +227,8 @@ void game::load_data_from_dir(const std::string &path)
 
 game::~game()
 {
+    // Waits for the overmap generated in the background, it uses the data unloaded here.
+    overmap_buffer.clear();
     DynamicDataLoader::get_instance().unload_data();
     MAPBUFFER.reset();
     delete gamemode;
@@ -576,6 +579,8 @@ void game::setup()
 
     remoteveh_cache_turn = INT_MIN;
     remoteveh_cache = nullptr;
+    off_bubble_vehicles.clear();
+    off_bubble_vehicles_turn = INT_MIN;
     // back to menu for save loading, new game etc
 }
 
@@ -616,6 +621,7 @@ void game::start_game(std::string worldname)
     // Init some factions.
     if (!load_master(worldname)) { // Master data record contains factions.
         create_factions();
+        overmap_buffer.set_seed( rand() );
     }
     u.setID( assign_npc_id() ); // should be as soon as possible, but *after* load_master
 
@@ -988,6 +994,56 @@ bool game::cleanup_at_end()
     return true;
 }
 
+void game::process_vehicle_power()
+{
+    // Process power and fuel consumption for all vehicles, including off-map ones.
+    // m.vehmove used to do this, but now it only give them moves instead.
+    const tripoint abs_sub = m.get_abs_sub();
+    const int mapsize = m.getmapsize();
+    for( auto &elem : m.get_vehicles() ) {
+        elem.v->power_parts( tripoint( abs_sub.x + elem.i, abs_sub.y + elem.j, abs_sub.z ) );
+        elem.v->idle( true );
+    }
+
+    const auto in_bubble = [&]( const tripoint &sm_loc ) {
+        return sm_loc.z == abs_sub.z &&
+               sm_loc.x >= abs_sub.x && sm_loc.x < abs_sub.x + mapsize &&
+               sm_loc.y >= abs_sub.y && sm_loc.y < abs_sub.y + mapsize;
+    };
+    // Vehicles with nothing running stay that way until someone comes by, and that
+    // makes them part of the reality bubble, so only the others need to be tracked.
+    // Vehicles that have left the bubble are picked up by the rescan after the shift.
+    if( off_bubble_vehicles_turn == INT_MIN || off_bubble_vehicles_origin != abs_sub ||
+        calendar::turn - off_bubble_vehicles_turn >= HOURS( 1 ) ) {
+        off_bubble_vehicles.clear();
+        for( auto &elem : MAPBUFFER ) {
+            if( in_bubble( elem.first ) ) {
+                continue;
+            }
+            for( auto &veh : elem.second->vehicles ) {
+                if( veh->needs_idle_processing() ) {
+                    off_bubble_vehicles.push_back( std::make_pair( elem.first, veh ) );
+                }
+            }
+        }
+        off_bubble_vehicles_origin = abs_sub;
+        off_bubble_vehicles_turn = calendar::turn;
+    }
+
+    for( auto &elem : off_bubble_vehicles ) {
+        const tripoint &sm_loc = elem.first;
+        // The vehicle may have been moved or destroyed since the list was built,
+        // only touch it if it is still where we left it.
+        const submap *sm = MAPBUFFER.lookup_submap( sm_loc.x, sm_loc.y, sm_loc.z );
+        if( sm == nullptr ||
+            std::find( sm->vehicles.begin(), sm->vehicles.end(), elem.second ) == sm->vehicles.end() ) {
+            continue;
+        }
+        elem.second->power_parts( sm_loc );
+        elem.second->idle( false );
+    }
+}
+
 static int veh_lumi(vehicle *veh)
 {
     float veh_luminance = 0.0;
@@ -1103,10 +1159,39 @@ void game::calc_driving_offset(vehicle *veh)
     set_driving_view_offset(point(offset.x, offset.y));
 }
 
+// Queues and generates the submaps the player is heading for, a few per turn, so that
+// shifting the map while driving through unexplored areas doesn't have to generate a whole
+// row of them at once. The direction is that of the vehicle the player is in, or otherwise
+// that of the last map shift.
+static void pregenerate_map( map &m, const player &u )
+{
+    // Overmap terrain tiles generated per turn and per submap of look ahead.
+    static const int tiles_per_turn = 2;
+    int dx = m.get_last_shift().x;
+    int dy = m.get_last_shift().y;
+    int distance = 1;
+    const vehicle *veh = u.in_vehicle ? m.veh_at( u.posx(), u.posy() ) : nullptr;
+    if( veh != nullptr && veh->velocity != 0 ) {
+        const double angle = veh->move.dir() * M_PI / 180.0;
+        const int sign = veh->velocity > 0 ? 1 : -1;
+        // Anything within ~22 degrees of an axis counts as moving along it.
+        dx = std::abs( cos( angle ) ) > 0.38 ? sign * ( cos( angle ) > 0 ? 1 : -1 ) : 0;
+        dy = std::abs( sin( angle ) ) > 0.38 ? sign * ( sin( angle ) > 0 ? 1 : -1 ) : 0;
+        // velocity is in 1/100 mph, a vehicle moves about velocity / 400 tiles per turn.
+        distance += std::abs( veh->velocity ) / ( 400 * SEEX );
+    }
+    m.queue_pregeneration( dx, dy, distance );
+    m.process_pregeneration( tiles_per_turn * distance );
+    // Whole overmaps take much longer, they are generated in the background long before
+    // the player gets there.
+    overmap_buffer.generate_ahead( g->global_omt_location(), OMAPX / 4 );
+}
+
 // MAIN GAME LOOP
 // Returns true if game is over (death, saved, quit, etc)
 bool game::do_turn()
 {
+    turn_profiler::scoped_timer turn_timer( turn_profiler::TP_TURN );
     if (is_game_over()) {
         return cleanup_at_end();
     }
@@ -1408,7 +1493,10 @@ bool game::do_turn()
         autosave();
     }
 
-    update_weather();
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_WEATHER );
+        update_weather();
+    }
 
     // The following happens when we stay still; 10/40 minutes overdue for spawn
     if ((!u.has_trait("INCONSPICUOUS") && calendar::turn > nextspawn + 100) ||
@@ -1417,7 +1505,10 @@ bool game::do_turn()
         nextspawn = calendar::turn;
     }
 
-    process_activity();
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_ACTIVITY );
+        process_activity();
+    }
 
     // Process sound events into sound markers for display to the player.
     sounds::process_sound_markers( &u );
@@ -1468,36 +1559,45 @@ bool game::do_turn()
             calc_driving_offset(veh);
         }
     }
-    update_scent();
-
-    m.vehmove();
-
-    // Process power and fuel consumption for all vehicles, including off-map ones.
-    // m.vehmove used to do this, but now it only give them moves instead.
-    for( auto &elem : MAPBUFFER ) {
-        tripoint sm_loc = elem.first;
-        point sm_topleft = overmapbuffer::sm_to_ms_copy(sm_loc.x, sm_loc.y);
-        point in_reality = m.getlocal(sm_topleft);
-
-        submap *sm = elem.second;
-
-        for( auto &_i : sm->vehicles ) {
-            auto veh = _i;
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_UPDATE_SCENT );
+        update_scent();
+    }
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_VEHMOVE );
+        m.vehmove();
+    }
 
-            veh->power_parts( sm_loc );
-            veh->idle( sm_loc.z == get_levz() && m.inbounds(in_reality.x, in_reality.y) );
-        }
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_VEHICLE_POWER );
+        process_vehicle_power();
+    }
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_PROCESS_FIELDS );
+        m.process_fields();
+    }
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_PROCESS_ACTIVE_ITEMS );
+        m.process_active_items();
     }
-    m.process_fields();
-    m.process_active_items();
     m.creature_in_field( u );
 
     // Apply sounds from previous turn to monster and NPC AI.
     sounds::process_sounds();
     // Update vision caches for monsters. If this turns out to be expensive,
     // consider a stripped down cache just for monsters.
-    m.build_map_cache();
-    monmove();
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_BUILD_MAP_CACHE );
+        m.build_map_cache();
+    }
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_MONMOVE );
+        monmove();
+    }
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_MAP_PREGEN );
+        pregenerate_map( m, u );
+    }
     update_stair_monsters();
     u.process_turn();
     u.process_active_items();
@@ -3671,18 +3771,36 @@ bool game::save_player_data()
         std::ofstream fout;
         fout.exceptions(std::ios::failbit | std::ios::badbit);
 
-        fout.open(std::string(playerfile + ".sav").c_str());
+        const std::string savefile = playerfile + ".sav";
+        fopen_exclusive(fout, savefile.c_str());
+        if (!fout.is_open()) {
+            popup(_("Failed to save player data"));
+            return false;
+        }
         serialize(fout);
-        fout.close();
+        if (!fclose_exclusive(fout, savefile.c_str())) {
+            return false;
+        }
         // weather
-        fout.open(std::string(playerfile + ".weather").c_str());
+        const std::string weatherfile = playerfile + ".weather";
+        fopen_exclusive(fout, weatherfile.c_str());
+        if (!fout.is_open()) {
+            popup(_("Failed to save player data"));
+            return false;
+        }
         save_weather(fout);
-        fout.close();
+        if (!fclose_exclusive(fout, weatherfile.c_str())) {
+            return false;
+        }
         // log
-        fout.open(std::string(playerfile + ".log").c_str());
+        const std::string logfile = playerfile + ".log";
+        fopen_exclusive(fout, logfile.c_str());
+        if (!fout.is_open()) {
+            popup(_("Failed to save player data"));
+            return false;
+        }
         fout << u.dump_memorial();
-        fout.close();
-        return true;
+        return fclose_exclusive(fout, logfile.c_str());
     } catch (std::ios::failure &err) {
         popup(_("Failed to save player data"));
         return false;
@@ -3910,11 +4028,12 @@ void game::debug()
                       _("Display hordes"), // 20
                       _("Test Item Group"), // 21
                       _("Damage Self"), //22
+                      _("Turn profiler"), // 23
 #ifndef TILES
-                      _("Show Sound Clustering"), //23
+                      _("Show Sound Clustering"), //24
 #endif
 #ifdef LUA
-                      _("Lua Command"), // 24
+                      _("Lua Command"), // 25
 #endif
                       _("Cancel"),
                       NULL);
@@ -4312,8 +4431,41 @@ void game::debug()
     }
     break;
 
-#ifndef TILES
     case 23: {
+        std::ostringstream report;
+        report << string_format( "%-22s %7s %9s %9s %9s %9s\n", "phase", "samples", "mean ms",
+                                 "median ms", "p95 ms", "max ms" );
+        for( int i = 0; i < turn_profiler::NUM_TURN_PHASES; i++ ) {
+            const auto phase = static_cast<turn_profiler::phase>( i );
+            const auto stats = turn_profiler::stats( phase );
+            report << string_format( "%-22s %7d %9.3f %9.3f %9.3f %9.3f\n",
+                                     turn_profiler::phase_name( phase ), stats.samples, stats.mean,
+                                     stats.median, stats.p95, stats.max );
+        }
+        full_screen_popup( "%s", report.str().c_str() );
+        const int log_interval = turn_profiler::get_log_interval();
+        const int choice = menu( true, _( "Turn profiler:" ), _( "Write CSV to debug log" ),
+                                 _( "Write JSON to debug log" ),
+                                 log_interval > 0 ? _( "Stop periodic logging" ) : _( "Start periodic logging" ),
+                                 _( "Reset" ), _( "Cancel" ), NULL );
+        if( choice == 1 ) {
+            DebugLog( D_INFO, D_GAME ) << "turn profile:\n" << turn_profiler::report_csv();
+        } else if( choice == 2 ) {
+            DebugLog( D_INFO, D_GAME ) << "turn profile: " << turn_profiler::report_json();
+        } else if( choice == 3 ) {
+            if( log_interval > 0 ) {
+                turn_profiler::set_log_interval( 0 );
+            } else {
+                turn_profiler::set_log_interval( query_int( _( "Write the profile every how many turns?" ) ) );
+            }
+        } else if( choice == 4 ) {
+            turn_profiler::reset();
+        }
+    }
+    break;
+
+#ifndef TILES
+    case 24: {
         const point offset{ POSX - u.posx() + u.view_offset_x,
                 POSY - u.posy() + u.view_offset_y };
         draw_ter();
@@ -4331,7 +4483,7 @@ void game::debug()
 #endif
 
 #ifdef LUA
-    case 24: {
+    case 25: {
         std::string luacode = string_input_popup(_("Lua:"), 60, "");
         call_lua(luacode);
     }
@@ -5752,12 +5904,14 @@ void game::monmove()
     }
 
     // Now, do active NPCs.
-    for( auto &elem : active_npc ) {
-        if( elem->is_dead() ) {
-            continue;
-        }
-        int turns = 0;
-        m.creature_in_field( *elem );
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::TP_NPCMOVE );
+        for( auto &elem : active_npc ) {
+            if( elem->is_dead() ) {
+                continue;
+            }
+            int turns = 0;
+            m.creature_in_field( *elem );
             ( elem )->process_turn();
             while( !( elem )->is_dead() && ( elem )->moves > 0 && turns < 10 ) {
                 int moves = ( elem )->moves;
@@ -5773,6 +5927,7 @@ void game::monmove()
                 add_msg( _( "%s's brain explodes!" ), ( elem )->name.c_str() );
                 ( elem )->die( nullptr );
             }
+        }
     }
     cleanup_dead();
 }
@@ -5829,7 +5984,6 @@ void game::do_blast(const int x, const int y, const int power, const int radius,
 void game::explosion(int x, int y, int power, int shrapnel, bool fire, bool blast)
 {
     int radius = int(sqrt(double(power / 4)));
-    int dam;
     int noise = power * (fire ? 2 : 10);
 
     if (power >= 30) {
@@ -5849,14 +6003,14 @@ void game::explosion(int x, int y, int power, int shrapnel, bool fire, bool blas
     if (shrapnel <= 0 || power < 4) {
         return;
     }
-    int sx, sy, t, tx, ty;
-    std::vector<point> traj;
-    timespec ts;
-    ts.tv_sec = 0;
-    ts.tv_nsec = 1000000 * OPTIONS["ANIMATION_DELAY"];
-    for (int i = 0; i < shrapnel; i++) {
-        sx = rng(x - 2 * radius, x + 2 * radius);
-        sy = rng(y - 2 * radius, y + 2 * radius);
+    // All fragments fly at once: first the trajectories of all of them are computed,
+    // then they are animated together, then the hits are applied. Each fragment is dealt
+    // separately, so armor applies to each one and a killed target stops taking hits.
+    std::vector<std::vector<point>> fragments( shrapnel );
+    for( auto &traj : fragments ) {
+        const int sx = rng(x - 2 * radius, x + 2 * radius);
+        const int sy = rng(y - 2 * radius, y + 2 * radius);
+        int t = 0;
         if (m.sees(x, y, sx, sy, 50, t)) {
             traj = line_to(x, y, sx, sy, t);
         } else {
@@ -5867,11 +6021,14 @@ void game::explosion(int x, int y, int power, int shrapnel, bool fire, bool blas
         if( sx !=x || sy != y ) {
             traj.insert( traj.begin(), point(x, y) );
         }
+    }
+    draw_shrapnel( fragments );
+
+    for( const auto &traj : fragments ) {
         for (size_t j = 0; j < traj.size(); j++) {
-            dam = rng(power / 2, power * 2);
-            draw_bullet(u, traj[j].x, traj[j].y, (int)j, traj, '`', ts);
-            tx = traj[j].x;
-            ty = traj[j].y;
+            int dam = rng(power / 2, power * 2);
+            const int tx = traj[j].x;
+            const int ty = traj[j].y;
             const int zid = mon_at(tx, ty);
             const int npcdex = npc_at(tx, ty);
             if (zid != -1) {
@@ -6630,9 +6787,10 @@ void game::rebuild_mon_at_cache()
 
 bool game::is_empty(const int x, const int y)
 {
-    return ((m.move_cost(x, y) > 0 || m.has_flag("LIQUID", x, y)) &&
-            npc_at(x, y) == -1 && mon_at(x, y) == -1 &&
-            (u.posx() != x || u.posy() != y));
+    // Cheapest checks first, the monster lookup is a single read from the creature tracker.
+    return ((u.posx() != x || u.posy() != y) && mon_at(x, y) == -1 &&
+            (m.move_cost(x, y) > 0 || m.has_flag(TFLAG_LIQUID, x, y)) &&
+            npc_at(x, y) == -1);
 }
 
 bool game::is_in_sunlight(int x, int y)
@@ -443,6 +443,11 @@ class game
         void draw_explosion(int x, int y, int radius, nc_color col);
         void draw_bullet(Creature &p, int tx, int ty, int i, std::vector<point> trajectory, char bullet,
                          timespec &ts);
+        /**
+         * Animates the fragments of an explosion, all of them move one square per frame.
+         * Nothing is drawn (and there is no delay) if the player can't see any of them.
+         */
+        void draw_shrapnel( const std::vector<std::vector<point>> &fragments );
         void draw_hit_mon(int x, int y, const monster &critter, bool dead = false);
         void draw_hit_player(player *p, const int iDam, bool dead = false);
         void draw_line(const int x, const int y, const point center_point, std::vector<point> ret);
@@ -492,6 +497,7 @@ class game
         void drop(std::vector<item> &dropped, std::vector<item> &dropped_worn,
                   int freed_volume_capacity, int dirx, int diry);
         bool make_drop_activity( enum activity_type act, point target );
+        void start_game(std::string worldname); // Starts a new game in a world
     private:
         // Game-start procedures
         void print_menu(WINDOW *w_open, int iSel, const int iMenuOffsetX, int iMenuOffsetY,
@@ -501,7 +507,6 @@ class game
         bool load_master(std::string worldname); // Load the master data file, with factions &c
         void load_weather(std::ifstream &fin);
         void load(std::string worldname, std::string name); // Load a player-specific save file
-        void start_game(std::string worldname); // Starts a new game in a world
         void start_special_game(special_game_id gametype); // See gamemode.cpp
 
         //private save functions.
@@ -667,6 +672,14 @@ class game
         bool disable_robot( point p );
 
         void update_scent();     // Updates the scent map
+        /**
+         * Power and fuel consumption of vehicles. Vehicles inside the reality bubble
+         * are processed every turn, vehicles outside of it only if they are listed in
+         * @ref off_bubble_vehicles. That list is rebuilt from the whole @ref mapbuffer
+         * only when the map has moved or once an hour, so the per-turn cost does
+         * not grow with the size of the explored world.
+         */
+        void process_vehicle_power();
         bool is_game_over();     // Returns true if the player quit or died
         void death_screen();     // Display our stats, "GAME OVER BOO HOO"
         void gameover();         // Ends the game
@@ -724,6 +737,10 @@ class game
         // remoteveh() cache
         int remoteveh_cache_turn;
         vehicle *remoteveh_cache;
+        // process_vehicle_power() cache: off-bubble vehicles that have something running
+        std::vector<std::pair<tripoint, vehicle *>> off_bubble_vehicles;
+        tripoint off_bubble_vehicles_origin;
+        int off_bubble_vehicles_turn;
 
         special_game *gamemode;
 
@@ -11,6 +11,8 @@ inventory::inventory()
 : nullitem()
 , nullstack()
 , invlet_cache()
+, cached_summary()
+, summary_valid(false)
 , items()
 , sorted(false)
 {
@@ -18,6 +20,7 @@ inventory::inventory()
 
 invslice inventory::slice()
 {
+    invalidate_summary();
     invslice stacks;
     for( auto &elem : items ) {
         stacks.push_back( &elem );
@@ -174,6 +177,7 @@ inventory inventory::operator+ (const item &rhs)
 
 indexed_invslice inventory::slice_filter()
 {
+    invalidate_summary();
     int i = 0;
     indexed_invslice stacks;
     for( auto &elem : items ) {
@@ -185,6 +189,7 @@ indexed_invslice inventory::slice_filter()
 
 indexed_invslice inventory::slice_filter_by_activation(const player &u)
 {
+    invalidate_summary();
     int i = 0;
     indexed_invslice stacks;
     for( auto &elem : items ) {
@@ -198,6 +203,7 @@ indexed_invslice inventory::slice_filter_by_activation(const player &u)
 
 indexed_invslice inventory::slice_filter_by_category(item_cat cat, const player &u)
 {
+    invalidate_summary();
     int i = 0;
     indexed_invslice stacks;
     for( auto &elem : items ) {
@@ -211,6 +217,7 @@ indexed_invslice inventory::slice_filter_by_category(item_cat cat, const player
 
 indexed_invslice inventory::slice_filter_by_flag(const std::string flag)
 {
+    invalidate_summary();
     int i = 0;
     indexed_invslice stacks;
     for( auto &elem : items ) {
@@ -224,6 +231,7 @@ indexed_invslice inventory::slice_filter_by_flag(const std::string flag)
 
 indexed_invslice inventory::slice_filter_by_capacity_for_liquid(const item &liquid)
 {
+    invalidate_summary();
     int i = 0;
     indexed_invslice stacks;
     for( auto &elem : items ) {
@@ -237,6 +245,7 @@ indexed_invslice inventory::slice_filter_by_capacity_for_liquid(const item &liqu
 
 indexed_invslice inventory::slice_filter_by_salvageability(const salvage_actor &actor)
 {
+    invalidate_summary();
     int i = 0;
     indexed_invslice stacks;
     for( auto &elem : items ) {
@@ -266,6 +275,7 @@ void inventory::sort()
 
 void inventory::clear()
 {
+    invalidate_summary();
     items.clear();
 }
 
@@ -281,6 +291,7 @@ void inventory::add_stack(const std::list<item> newits)
  */
 void inventory::clone_stack (const std::list<item> &rhs)
 {
+    invalidate_summary();
     std::list<item> newstack;
     for( const auto &rh : rhs ) {
         newstack.push_back( rh );
@@ -362,6 +373,7 @@ char inventory::find_usable_cached_invlet(const std::string &item_type)
 
 item &inventory::add_item(item newit, bool keep_invlet, bool assign_invlet)
 {
+    invalidate_summary();
     bool reuse_cached_letter = false;
 
     // Avoid letters that have been manually assigned to other things.
@@ -430,6 +442,7 @@ void inventory::push_back(item newit)
 
 void inventory::restack(player *p)
 {
+    invalidate_summary();
     // tasks that the old restack seemed to do:
     // 1. reassign inventory letters
     // 2. remove items from non-matching stacks
@@ -491,6 +504,7 @@ static long count_charges_in_list(const itype *type, const map_stack &items)
 
 void inventory::form_from_map(point origin, int range, bool assign_invlet)
 {
+    invalidate_summary();
     items.clear();
     for (int x = origin.x - range; x <= origin.x + range; x++) {
         for (int y = origin.y - range; y <= origin.y + range; y++) {
@@ -661,6 +675,7 @@ void inventory::form_from_map(point origin, int range, bool assign_invlet)
 template<typename Locator>
 std::list<item> inventory::reduce_stack_internal(const Locator &locator, int quantity)
 {
+    invalidate_summary();
     int pos = 0;
     std::list<item> ret;
     for (invstack::iterator iter = items.begin(); iter != items.end(); ++iter) {
@@ -704,6 +719,7 @@ item inventory::remove_item(const item *it)
 template<typename Locator>
 item inventory::remove_item_internal(const Locator &locator)
 {
+    invalidate_summary();
     int pos = 0;
     for (invstack::iterator iter = items.begin(); iter != items.end(); ++iter) {
         if (item_matches_locator(iter->front(), locator, pos)) {
@@ -734,6 +750,7 @@ item inventory::remove_item(int position)
 
 void inventory::dump(std::vector<item *> &dest)
 {
+    invalidate_summary();
     for( auto &elem : items ) {
         for( auto &elem_stack_iter : elem ) {
             dest.push_back( &( elem_stack_iter ) );
@@ -743,6 +760,7 @@ void inventory::dump(std::vector<item *> &dest)
 
 item &inventory::find_item(int position)
 {
+    invalidate_summary();
     if (position < 0 || position >= (int)items.size()) {
         return nullitem;
     }
@@ -784,6 +802,7 @@ int inventory::position_by_item( const item *it ) const
 
 item &inventory::item_by_type(itype_id type)
 {
+    invalidate_summary();
     for( auto &elem : items ) {
         if( elem.front().type->id == type ) {
             return elem.front();
@@ -805,6 +824,7 @@ int inventory::position_by_type(itype_id type)
 }
 item &inventory::item_or_container(itype_id type)
 {
+    invalidate_summary();
     for( auto &elem : items ) {
         for( auto &elem_stack_iter : elem ) {
             if( elem_stack_iter.type->id == type ) {
@@ -822,6 +842,7 @@ item &inventory::item_or_container(itype_id type)
 
 std::vector<std::pair<item *, int> > inventory::all_items_by_type(itype_id type)
 {
+    invalidate_summary();
     std::vector<std::pair<item *, int> > ret;
     int i = 0;
     for( auto &elem : items ) {
@@ -842,28 +863,21 @@ int inventory::amount_of(itype_id it) const
 
 int inventory::amount_of(itype_id it, bool used_as_tool) const
 {
-    int count = 0;
-    for( const auto &elem : items ) {
-        for( const auto &elem_stack_iter : elem ) {
-            count += elem_stack_iter.amount_of( it, used_as_tool );
-        }
-    }
-    return count;
+    const auto &counts = used_as_tool ? get_summary().tools : get_summary().components;
+    const auto found = counts.find( it );
+    return found == counts.end() ? 0 : found->second;
 }
 
 long inventory::charges_of(itype_id it) const
 {
-    int count = 0;
-    for( const auto &elem : items ) {
-        for( const auto &elem_stack_iter : elem ) {
-            count += elem_stack_iter.charges_of( it );
-        }
-    }
-    return count;
+    const auto &charges = get_summary().charges;
+    const auto found = charges.find( it );
+    return found == charges.end() ? 0 : found->second;
 }
 
 std::list<item> inventory::use_amount(itype_id it, int quantity, bool use_container)
 {
+    invalidate_summary();
     sort();
     std::list<item> ret;
     for (invstack::iterator iter = items.begin(); iter != items.end() && quantity > 0; /* noop */) {
@@ -887,6 +901,7 @@ std::list<item> inventory::use_amount(itype_id it, int quantity, bool use_contai
 
 std::list<item> inventory::use_charges(itype_id it, long quantity)
 {
+    invalidate_summary();
     sort();
     std::list<item> ret;
     for (invstack::iterator iter = items.begin(); iter != items.end() && quantity > 0; /* noop */) {
@@ -941,26 +956,104 @@ bool inventory::has_item( const item *it ) const
 
 bool inventory::has_items_with_quality(std::string id, int level, int amount) const
 {
+    const auto &qualities = get_summary().qualities;
+    const auto quality = qualities.find( id );
+    if( quality == qualities.end() ) {
+        return false;
+    }
     int found = 0;
-    for( const auto &elem : items ) {
-        for( const auto &elem_stack_iter : elem ) {
-            if( !elem_stack_iter.contents.empty() && elem_stack_iter.is_container() ) {
-                continue;
-            }
-            if( elem_stack_iter.has_quality( id, level ) ) {
-                if( elem_stack_iter.count_by_charges() ) {
-                    found += elem_stack_iter.charges;
-                } else {
-                    found++;
-                }
+    for( auto iter = quality->second.lower_bound( level ); iter != quality->second.end(); ++iter ) {
+        found += iter->second;
+    }
+    return found >= amount;
+}
+
+void inventory::add_to_summary( summary &sum, const item &it )
+{
+    // Mirrors item::amount_of and item::charges_of: containers are only counted when empty.
+    if( it.contents.empty() ) {
+        sum.tools[it.typeId()]++;
+        if( !it.has_flag( "PSEUDO" ) ) {
+            sum.components[it.typeId()]++;
+        }
+        const long charges = it.charges < 0 ? 1 : it.charges;
+        sum.charges[it.typeId()] += charges;
+        if( it.is_tool() ) {
+            const itype_id &subtype = dynamic_cast<const it_tool *>( it.type )->subtype;
+            if( !subtype.empty() && subtype != it.typeId() ) {
+                sum.charges[subtype] += charges;
             }
         }
     }
-    if(found >= amount) {
-        return true;
-    } else {
+    for( const auto &content : it.contents ) {
+        add_to_summary( sum, content );
+    }
+}
+
+inventory::summary_entry inventory::make_summary_entry( const item &it )
+{
+    return summary_entry{ it.type, it.charges, it.contents.size(), it.item_tags.count( "PSEUDO" ) > 0 };
+}
+
+void inventory::add_summary_state( std::vector<summary_entry> &state, const item &it )
+{
+    state.push_back( make_summary_entry( it ) );
+    for( const auto &content : it.contents ) {
+        add_summary_state( state, content );
+    }
+}
+
+bool inventory::matches_summary_state( const std::vector<summary_entry> &state, size_t &index,
+                                       const item &it )
+{
+    if( index >= state.size() || !( state[index] == make_summary_entry( it ) ) ) {
         return false;
     }
+    index++;
+    for( const auto &content : it.contents ) {
+        if( !matches_summary_state( state, index, content ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool inventory::summary_state_matches() const
+{
+    size_t index = 0;
+    for( const auto &stack : items ) {
+        for( const auto &it : stack ) {
+            if( !matches_summary_state( summary_state, index, it ) ) {
+                return false;
+            }
+        }
+    }
+    return index == summary_state.size();
+}
+
+const inventory::summary &inventory::get_summary() const
+{
+    if( summary_valid && summary_state_matches() ) {
+        return cached_summary;
+    }
+    cached_summary = summary();
+    summary_state.clear();
+    for( const auto &stack : items ) {
+        for( const auto &it : stack ) {
+            add_to_summary( cached_summary, it );
+            add_summary_state( summary_state, it );
+            // Filled containers do not provide their qualities, see has_items_with_quality.
+            if( !it.contents.empty() && it.is_container() ) {
+                continue;
+            }
+            const int count = it.count_by_charges() ? it.charges : 1;
+            for( const auto &quality : it.type->qualities ) {
+                cached_summary.qualities[quality.first][quality.second] += count;
+            }
+        }
+    }
+    summary_valid = true;
+    return cached_summary;
 }
 
 int inventory::leak_level(std::string flag) const
@@ -1021,6 +1114,7 @@ bool inventory::has_enough_painkiller(int pain) const
 
 item *inventory::most_appropriate_painkiller(int pain)
 {
+    invalidate_summary();
     int difference = 9999;
     item *ret = &nullitem;
     for( auto &elem : items ) {
@@ -1048,6 +1142,7 @@ item *inventory::most_appropriate_painkiller(int pain)
 
 item *inventory::best_for_melee(player *p)
 {
+    invalidate_summary();
     item *ret = &nullitem;
     int best = 0;
     for( auto &elem : items ) {
@@ -1062,6 +1157,7 @@ item *inventory::best_for_melee(player *p)
 
 item *inventory::most_loaded_gun()
 {
+    invalidate_summary();
     item *ret = &nullitem;
     int max = 0;
     for( auto &elem : items ) {
@@ -1075,6 +1171,7 @@ item *inventory::most_loaded_gun()
 
 void inventory::rust_iron_items()
 {
+    invalidate_summary();
     for( auto &elem : items ) {
         for( auto &elem_stack_iter : elem ) {
             if( elem_stack_iter.made_of( "iron" ) &&
@@ -1111,6 +1208,7 @@ int inventory::volume() const
 
 std::vector<item *> inventory::active_items()
 {
+    invalidate_summary();
     std::vector<item *> ret;
     for( auto &elem : items ) {
         for( auto &elem_stack_iter : elem ) {
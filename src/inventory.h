@@ -5,7 +5,9 @@
 #include "enums.h"
 
 #include <list>
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -174,6 +176,7 @@ class inventory
         template<typename T>
         indexed_invslice slice_filter_by( T filter )
         {
+            invalidate_summary();
             int i = 0;
             indexed_invslice stacks;
             for( auto &elem : items ) {
@@ -247,6 +250,7 @@ class inventory
         template<typename T>
         std::vector<item *> items_with(T filter)
         {
+            invalidate_summary();
             std::vector<item *> result;
             for( auto &stack : items ) {
                 for( auto &it : stack ) {
@@ -259,6 +263,7 @@ class inventory
         template<typename T>
         std::list<item> remove_items_with( T filter )
         {
+            invalidate_summary();
             std::list<item> result;
             for( auto items_it = items.begin(); items_it != items.end(); ) {
                 auto &stack = *items_it;
@@ -294,6 +299,53 @@ class inventory
         template<typename Locator> item remove_item_internal(const Locator &locator);
         template<typename Locator> std::list<item> reduce_stack_internal(const Locator &type, int amount);
 
+        /**
+         * Totals of everything stored in this inventory (including the contents of
+         * containers), so that the amount/charges/quality queries used by crafting
+         * and construction are map lookups instead of walks over every stack.
+         * It is rebuilt by the first query after the inventory has been changed.
+         * Items can also be changed through references handed out earlier, so before
+         * the summary is reused, the items are compared against @ref summary_state.
+         */
+        struct summary {
+            /** Same as @ref item::amount_of with used_as_tool true / false. */
+            std::unordered_map<itype_id, int> tools;
+            std::unordered_map<itype_id, int> components;
+            /** Same as @ref item::charges_of, keyed by item type and tool subtype. */
+            std::unordered_map<itype_id, long> charges;
+            /** Quality id -> quality level -> number of matching items (or charges). */
+            std::unordered_map<std::string, std::map<int, int>> qualities;
+        };
+        /** The parts of an item (not including its contents) the summary depends on. */
+        struct summary_entry {
+            const itype *type;
+            long charges;
+            size_t contents;
+            bool pseudo;
+            bool operator==( const summary_entry &other ) const
+            {
+                return type == other.type && charges == other.charges &&
+                       contents == other.contents && pseudo == other.pseudo;
+            }
+        };
+        mutable summary cached_summary;
+        /** One entry for each item (and content, depth first) the summary was built from. */
+        mutable std::vector<summary_entry> summary_state;
+        mutable bool summary_valid;
+        /** Must be called by every function that changes items or hands out non-const access. */
+        void invalidate_summary()
+        {
+            summary_valid = false;
+        }
+        const summary &get_summary() const;
+        static void add_to_summary( summary &sum, const item &it );
+        static summary_entry make_summary_entry( const item &it );
+        static void add_summary_state( std::vector<summary_entry> &state, const item &it );
+        static bool matches_summary_state( const std::vector<summary_entry> &state, size_t &index,
+                                           const item &it );
+        /** Whether the items are still the same as when the summary was built. */
+        bool summary_state_matches() const;
+
         invstack items;
         bool sorted;
 };
@@ -68,12 +68,16 @@ item::item()
 }
 
 item::item(const std::string new_type, unsigned int turn, bool rand, const handedness handed)
+    : item( find_type( new_type ), turn, rand, handed )
+{
+}
+
+item::item( itype *new_type, unsigned int turn, bool rand, const handedness handed )
 {
     init();
-    type = find_type( new_type );
+    type = new_type;
     bday = turn;
     corpse = type->id == "corpse" ? GetMType( "mon_null" ) : nullptr;
-    name = type_name(1);
     const bool has_random_charges = rand && type->spawn && type->spawn->rand_charges.size() > 1;
     if( has_random_charges ) {
         const auto charge_roll = rng( 1, type->spawn->rand_charges.size() - 1 );
@@ -157,7 +161,7 @@ void item::make_corpse()
 void item::make_corpse( mtype *mt, unsigned int turn, const std::string &name )
 {
     make_corpse( mt, turn );
-    this->name = name;
+    extra.ensure().corpse_name = name;
 }
 
 item::item(std::string itemdata)
@@ -174,8 +178,63 @@ item::~item()
 {
 }
 
+item_extra_ptr::item_extra_ptr( const item_extra_ptr &other )
+    : ptr( other.ptr ? new item_extra( *other.ptr ) : nullptr )
+{
+}
+
+item_extra_ptr::item_extra_ptr( item_extra_ptr &&other ) = default;
+
+item_extra_ptr::~item_extra_ptr() = default;
+
+item_extra_ptr &item_extra_ptr::operator=( const item_extra_ptr &other )
+{
+    if( this != &other ) {
+        ptr.reset( other.ptr ? new item_extra( *other.ptr ) : nullptr );
+    }
+    return *this;
+}
+
+item_extra_ptr &item_extra_ptr::operator=( item_extra_ptr &&other ) = default;
+
+item_extra &item_extra_ptr::ensure()
+{
+    if( !ptr ) {
+        ptr.reset( new item_extra() );
+    }
+    return *ptr;
+}
+
+const std::map<std::string, std::string> &item::get_item_vars() const
+{
+    static const std::map<std::string, std::string> no_vars;
+    return extra.get() != nullptr ? extra.get()->item_vars : no_vars;
+}
+
+std::map<std::string, std::string> &item::edit_item_vars()
+{
+    return extra.ensure().item_vars;
+}
+
+const std::string &item::corpse_name() const
+{
+    static const std::string no_name;
+    return extra.get() != nullptr ? extra.get()->corpse_name : no_name;
+}
+
+const item::t_item_vector &item::get_components() const
+{
+    static const t_item_vector no_components;
+    return extra.get() != nullptr ? extra.get()->components : no_components;
+}
+
+item::t_item_vector &item::edit_components()
+{
+    return extra.ensure().components;
+}
+
 void item::init() {
-    name = "";
+    extra = item_extra_ptr();
     charges = -1;
     bday = 0;
     invlet = 0;
@@ -255,7 +314,9 @@ void item::clear()
     // Seems risky to - there aren't any reported content-clearing bugs
     // init(); // this should not go here either, or make() should not use it...
     item_tags.clear();
-    item_vars.clear();
+    if( extra.get() != nullptr ) {
+        extra.get()->item_vars.clear();
+    }
 }
 
 bool item::is_null() const
@@ -350,7 +411,7 @@ bool item::stacks_with( const item &rhs ) const
     if( item_tags != rhs.item_tags ) {
         return false;
     }
-    if( item_vars != rhs.item_vars ) {
+    if( get_item_vars() != rhs.get_item_vars() ) {
         return false;
     }
     if( goes_bad() ) {
@@ -417,11 +478,12 @@ void item::set_var( const std::string &name, const int value )
     std::ostringstream tmpstream;
     tmpstream.imbue( std::locale::classic() );
     tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    edit_item_vars()[name] = tmpstream.str();
 }
 
 int item::get_var( const std::string &name, const int default_value ) const
 {
+    const auto &item_vars = get_item_vars();
     const auto it = item_vars.find( name );
     if( it == item_vars.end() ) {
         return default_value;
@@ -434,11 +496,12 @@ void item::set_var( const std::string &name, const long value )
     std::ostringstream tmpstream;
     tmpstream.imbue( std::locale::classic() );
     tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    edit_item_vars()[name] = tmpstream.str();
 }
 
 long item::get_var( const std::string &name, const long default_value ) const
 {
+    const auto &item_vars = get_item_vars();
     const auto it = item_vars.find( name );
     if( it == item_vars.end() ) {
         return default_value;
@@ -448,11 +511,12 @@ long item::get_var( const std::string &name, const long default_value ) const
 
 void item::set_var( const std::string &name, const double value )
 {
-    item_vars[name] = string_format( "%f", value );
+    edit_item_vars()[name] = string_format( "%f", value );
 }
 
 double item::get_var( const std::string &name, const double default_value ) const
 {
+    const auto &item_vars = get_item_vars();
     const auto it = item_vars.find( name );
     if( it == item_vars.end() ) {
         return default_value;
@@ -462,11 +526,12 @@ double item::get_var( const std::string &name, const double default_value ) cons
 
 void item::set_var( const std::string &name, const std::string &value )
 {
-    item_vars[name] = value;
+    edit_item_vars()[name] = value;
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
 {
+    const auto &item_vars = get_item_vars();
     const auto it = item_vars.find( name );
     if( it == item_vars.end() ) {
         return default_value;
@@ -481,12 +546,14 @@ std::string item::get_var( const std::string &name ) const
 
 bool item::has_var( const std::string &name ) const
 {
-    return item_vars.count( name ) > 0;
+    return get_item_vars().count( name ) > 0;
 }
 
 void item::erase_var( const std::string &name )
 {
-    item_vars.erase( name );
+    if( extra.get() != nullptr ) {
+        extra.get()->item_vars.erase( name );
+    }
 }
 
 bool itag2ivar( std::string &item_tag, std::map<std::string, std::string> &item_vars ) {
@@ -1095,7 +1162,7 @@ std::string item::info(bool showtext, std::vector<iteminfo> *dump, bool debug) c
         }
     }
 
-    if (!components.empty()) {
+    if( !get_components().empty() ) {
         dump->push_back( iteminfo( "DESCRIPTION", string_format( _("Made from: %s"), components_to_string().c_str() ) ) );
     } else {
         const recipe *dis_recipe = get_disassemble_recipe( type->id );
@@ -1124,6 +1191,7 @@ std::string item::info(bool showtext, std::vector<iteminfo> *dump, bool debug) c
     }
 
     if ( showtext && !is_null() ) {
+        const auto &item_vars = get_item_vars();
         const std::map<std::string, std::string>::const_iterator idescription = item_vars.find("description");
         dump->push_back(iteminfo("DESCRIPTION", "--"));
         if( !type->snippet_category.empty() ) {
@@ -1711,13 +1779,14 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
         }
     }
 
+    const auto &item_vars = get_item_vars();
     const std::map<std::string, std::string>::const_iterator iname = item_vars.find("name");
     std::string maintext = "";
     if (corpse != NULL && typeId() == "corpse" ) {
-        if (name != "") {
+        if( !corpse_name().empty() ) {
             maintext = rmp_format(ngettext("<item_name>%s corpse of %s",
                                            "<item_name>%s corpses of %s",
-                                           quantity), corpse->nname().c_str(), name.c_str());
+                                           quantity), corpse->nname().c_str(), corpse_name().c_str());
         } else {
             maintext = rmp_format(ngettext("<item_name>%s corpse",
                                            "<item_name>%s corpses",
@@ -1846,7 +1915,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
                         vehtext.c_str(), maintext.c_str(), tagtext.c_str());
 
     static const std::string const_str_item_note("item_note");
-    if( item_vars.find(const_str_item_note) != item_vars.end() ) {
+    if( has_var( const_str_item_note ) ) {
         //~ %s is an item name. This style is used to denote items with notes.
         return string_format(_("*%s*"), ret.str().c_str());
     } else {
@@ -4388,6 +4457,7 @@ int item::butcher_factor() const
 static const std::string USED_BY_IDS( "USED_BY_IDS" );
 bool item::already_used_by_player(const player &p) const
 {
+    const auto &item_vars = get_item_vars();
     const auto it = item_vars.find( USED_BY_IDS );
     if( it == item_vars.end() ) {
         return false;
@@ -4401,7 +4471,7 @@ bool item::already_used_by_player(const player &p) const
 
 void item::mark_as_used_by_player(const player &p)
 {
-    std::string &used_by_ids = item_vars[ USED_BY_IDS ];
+    std::string &used_by_ids = edit_item_vars()[ USED_BY_IDS ];
     if( used_by_ids.empty() ) {
         // *always* start with a ';'
         used_by_ids = ";";
@@ -4468,7 +4538,7 @@ std::string item::components_to_string() const
 {
     typedef std::map<std::string, int> t_count_map;
     t_count_map counts;
-    for( const auto &elem : components ) {
+    for( const auto &elem : get_components() ) {
         const std::string name = elem.display_name();
         counts[name]++;
     }
@@ -4999,16 +5069,17 @@ bool item::has_effect_when_carried( art_effect_passive effect ) const
 
 std::string item::type_name( unsigned int quantity ) const
 {
+    const auto &item_vars = get_item_vars();
     const auto iter = item_vars.find( "name" );
     if( corpse != nullptr && typeId() == "corpse" ) {
-        if( name.empty() ) {
+        if( corpse_name().empty() ) {
             return rmp_format( ngettext( "<item_name>%s corpse",
                                          "<item_name>%s corpses", quantity ),
                                corpse->nname().c_str() );
         } else {
             return rmp_format( ngettext( "<item_name>%s corpse of %s",
                                          "<item_name>%s corpses of %s", quantity ),
-                               corpse->nname().c_str(), name.c_str() );
+                               corpse->nname().c_str(), corpse_name().c_str() );
         }
     } else if( typeId() == "blood" ) {
         if( corpse == nullptr || corpse->id == "mon_null" ) {
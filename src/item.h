@@ -8,6 +8,8 @@
 #include <bitset>
 #include <unordered_set>
 #include <set>
+#include <map>
+#include <memory>
 #include "artifact.h"
 #include "itype.h"
 #include "mtype.h"
@@ -21,6 +23,7 @@ struct itype;
 struct islot_armor;
 class material_type;
 class item_category;
+struct item_extra;
 
 std::string const& rad_badge_color(int rad);
 
@@ -31,6 +34,31 @@ struct light_emission {
 };
 extern light_emission nolight;
 
+/**
+ * Owning pointer to the @ref item_extra of an item. Copying it copies the data, so items
+ * stay copyable as before.
+ */
+class item_extra_ptr
+{
+    public:
+        item_extra_ptr() = default;
+        item_extra_ptr( const item_extra_ptr &other );
+        item_extra_ptr( item_extra_ptr &&other );
+        ~item_extra_ptr();
+        item_extra_ptr &operator=( const item_extra_ptr &other );
+        item_extra_ptr &operator=( item_extra_ptr &&other );
+
+        /** Null if the data has not been allocated. */
+        item_extra *get() const
+        {
+            return ptr.get();
+        }
+        /** Returns the data, allocates it (empty) first if needed. */
+        item_extra &ensure();
+    private:
+        std::unique_ptr<item_extra> ptr;
+};
+
 struct iteminfo {
     public:
         std::string sType; //Itemtype
@@ -90,6 +118,12 @@ class item : public JsonSerializer, public JsonDeserializer
 public:
  item();
  item(const std::string new_type, unsigned int turn, bool rand = true, handedness handed = NONE);
+        /**
+         * Same as the constructor above, but takes the item type itself, which saves the lookup
+         * when the type is already known (e.g. from @ref Item_factory::find_template).
+         * @param new_type Must not be null.
+         */
+        item( itype *new_type, unsigned int turn, bool rand = true, handedness handed = NONE );
 
         /**
          * Make this a corpse of the given monster type.
@@ -520,7 +554,15 @@ public:
  int get_remaining_capacity_for_liquid(const item &liquid) const;
 
  bool operator<(const item& other) const;
-    /** List of all @ref components in printable form, empty if this item has
+    typedef std::vector<item> t_item_vector;
+    /**
+     * The items this one has been crafted from, they are given back when it's disassembled.
+     * Usually empty.
+     */
+    const t_item_vector &get_components() const;
+    /** Same as @ref get_components, but the list can be changed. */
+    t_item_vector &edit_components();
+    /** List of all @ref get_components in printable form, empty if this item has
      * no components */
     std::string components_to_string() const;
 
@@ -918,20 +960,24 @@ public:
         static bool type_is_defined( const itype_id &id );
 
     private:
-        std::string name;
+        /** The item variables (@ref set_var), an empty map if there are none. */
+        const std::map<std::string, std::string> &get_item_vars() const;
+        /** Same as @ref get_item_vars, but for changing them, allocates @ref extra if needed. */
+        std::map<std::string, std::string> &edit_item_vars();
+        /** The name given to a corpse by @ref make_corpse, empty if it has none. */
+        const std::string &corpse_name() const;
+
         std::bitset<num_bp> covered_bodyparts;
         itype* curammo;
-        std::map<std::string, std::string> item_vars;
         // TODO: make a pointer to const
         mtype* corpse;
+        /** Rarely used data (item variables, components, corpse name), null if the item has none. */
+        item_extra_ptr extra;
 public:
- char invlet;             // Inventory letter
+ // Ordered by size to keep the item small.
  long charges;
- bool active;             // If true, it has active effects to be processed
- signed char damage;      // How much damage it's sustained; generally, max is 5
  int burnt;               // How badly we're burnt
  int bday;                // The turn on which it was created
- light_emission light;
  union{
    int poison;          // How badly poisoned is it?
    int bigness;         // engine power, wheel size
@@ -939,17 +985,32 @@ public:
    int note;            // Associated dynamic text snippet.
    int irridation;      // Tracks radiation dosage.
  };
- std::set<std::string> item_tags; // generic item specific flags
  unsigned item_counter; // generic counter to be used with item flags
  int mission_id; // Refers to a mission in game's master list
  int player_id; // Only give a mission to the right player!
- typedef std::vector<item> t_item_vector;
- t_item_vector components;
+ light_emission light;
+ char invlet;             // Inventory letter
+ bool active;             // If true, it has active effects to be processed
+ signed char damage;      // How much damage it's sustained; generally, max is 5
+ std::set<std::string> item_tags; // generic item specific flags
 
  int quiver_store_arrow(item &arrow);
  int max_charges_from_flag(std::string flagName);
 };
 
+/**
+ * The data of an @ref item that only few items have. It's kept out of the item itself to keep
+ * the common items small, see @ref item::extra.
+ */
+struct item_extra {
+    /** See @ref item::make_corpse. */
+    std::string corpse_name;
+    /** See @ref item::set_var. */
+    std::map<std::string, std::string> item_vars;
+    /** See @ref item::get_components. */
+    item::t_item_vector components;
+};
+
 bool item_compare_by_charges( const item& left, const item& right);
 bool item_ptr_compare_by_charges( const item *left, const item *right);
 
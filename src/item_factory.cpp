@@ -515,10 +515,15 @@ itype *Item_factory::find_template(Item_tag id)
                                            "  You think it wants to be a %s.", id.c_str());
     bad_itype->sym = '.';
     bad_itype->color = c_white;
-    m_templates[id] = bad_itype;
+    add_item_type( bad_itype );
     return bad_itype;
 }
 
+itype *Item_factory::find_template( int loadid ) const
+{
+    return m_types[loadid];
+}
+
 void Item_factory::add_item_type(itype *new_type)
 {
     if( new_type == nullptr ) {
@@ -526,7 +531,14 @@ void Item_factory::add_item_type(itype *new_type)
         return;
     }
     auto &entry = m_templates[new_type->id];
-    delete entry;
+    if( entry != nullptr ) {
+        new_type->loadid = entry->loadid;
+        delete entry;
+    } else {
+        new_type->loadid = m_types.size();
+        m_types.push_back( nullptr );
+    }
+    m_types[new_type->loadid] = new_type;
     entry = new_type;
 }
 
@@ -851,13 +863,9 @@ void Item_factory::load_basic_info(JsonObject &jo, itype *new_item_template)
 {
     std::string new_id = jo.get_string("id");
     new_item_template->id = new_id;
-    if (m_templates.count(new_id) > 0) {
-        // New item already exists. Because mods are loaded after
-        // core data, we override it. This allows mods to change
-        // item from core data.
-        delete m_templates[new_id];
-    }
-    m_templates[new_id] = new_item_template;
+    // If the item already exists it is replaced. Because mods are loaded after
+    // core data, this allows mods to change items from core data.
+    add_item_type( new_item_template );
 
     // And then proceed to assign the correct field
     new_item_template->price = jo.get_int("price");
@@ -1107,6 +1115,7 @@ void Item_factory::clear()
         delete elem.second;
     }
     m_templates.clear();
+    m_types.clear();
     item_blacklist.clear();
     item_whitelist.clear();
 }
@@ -186,8 +186,14 @@ class Item_factory
          */
         itype *find_template( Item_tag id );
         /**
-         * Add a passed in itype to the collection of item types.
-         * If the item type overrides an existing type, the existing type is deleted first.
+         * Returns the itype with the given @ref itype::loadid, without any string lookup.
+         * @param loadid Must be the loadid of a loaded item type.
+         */
+        itype *find_template( int loadid ) const;
+        /**
+         * Add a passed in itype to the collection of item types and assign its loadid.
+         * If the item type overrides an existing type, the existing type is deleted first
+         * and the new type takes over its loadid.
          * @param new_type The new item type, must not be null.
          */
         void add_item_type( itype *new_type );
@@ -214,6 +220,8 @@ class Item_factory
         Item_tag create_artifact_id() const;
     private:
         std::map<Item_tag, itype *> m_templates;
+        /** Same types as in m_templates, indexed by their loadid. */
+        std::vector<itype *> m_types;
         typedef std::map<Group_tag, Item_spawn_data *> GroupMap;
         GroupMap m_template_groups;
 
@@ -40,7 +40,10 @@ item Single_item_creator::create_single(int birthday, RecursionList &rec) const
         if (id == "corpse") {
             tmp.make_corpse( "mon_null", birthday );
         } else {
-            tmp = item(id, birthday);
+            if( item_loadid < 0 ) {
+                item_loadid = item::find_type( id )->loadid;
+            }
+            tmp = item( item_controller->find_template( item_loadid ), birthday );
         }
     } else if (type == S_ITEM_GROUP) {
         if (std::find(rec.begin(), rec.end(), id) != rec.end()) {
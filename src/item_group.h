@@ -198,6 +198,12 @@ class Single_item_creator : public Item_spawn_data
         virtual void check_consistency() const;
         virtual bool remove_item(const Item_tag &itemid);
         virtual bool has_item(const Item_tag &itemid) const;
+    private:
+        /**
+         * @ref itype::loadid of the item (type S_ITEM), looked up on first use, so later
+         * spawns don't need the lookup by id. -1 if not looked up yet.
+         */
+        mutable int item_loadid = -1;
 };
 
 /**
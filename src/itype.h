@@ -378,6 +378,11 @@ struct itype {
     // can be used as lookup key in master itype map
     // Used for save files; aligns to itype_id above.
     std::string id;
+    /**
+     * Dense index of this type in the @ref Item_factory, assigned when the type is added
+     * there, -1 before that. Only valid while the item types are loaded, don't save it.
+     */
+    int loadid = -1;
     /**
      * Slots for various item type properties. Each slot may contain a valid pointer or null, check
      * this before using it.
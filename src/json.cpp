@@ -1,6 +1,7 @@
 #include "json.h"
 
 #include <cmath> // pow
+#include <cstdio> // snprintf
 #include <cstdlib> // strtoul
 #include <cstring> // strcmp
 #include <fstream>
@@ -1556,32 +1557,63 @@ std::string JsonIn::substr(size_t pos, size_t len)
  * represents an ostream of JSON data,
  * allowing easy serialization of c++ datatypes.
  */
+// size at which the buffered output is written to the stream even inside of a value
+static const size_t json_out_flush_size = 64 * 1024;
+
 JsonOut::JsonOut(std::ostream &s, bool pretty)
-    :   stream(&s), pretty_print(pretty), need_separator(false), indent_level(0)
+    :   stream(&s), pretty_print(pretty), need_separator(false), indent_level(0), nesting(0)
 {
+    // The output is formatted by JsonOut itself, but callers may write numbers
+    // to the stream directly, so keep the stream in the format it used to have:
     // ensure user's locale doesn't interfere with number format
     stream->imbue(std::locale::classic());
     // scientific format for floating-point numbers
     stream->setf(std::ostream::scientific, std::ostream::floatfield);
     // it's already decimal, but set it anyway
     stream->setf(std::ostream::dec, std::ostream::basefield);
-    // could also set showbase and showpoint,
-    // but it currently doesn't matter.
 }
 
-void JsonOut::write_indent()
+JsonOut::~JsonOut()
+{
+    // Only happens if the output was abandoned in the middle of a value
+    // (e.g. because of an exception), the stream may be in a failed state.
+    try {
+        flush();
+    } catch (std::ios::failure &) {
+    }
+}
+
+void JsonOut::flush()
 {
-    const char indent[5] = "    ";
-    for (int i = 0; i < indent_level; ++i) {
-        stream->write(indent, 4);
+    if (!buffer.empty()) {
+        stream->write(buffer.data(), buffer.size());
+        buffer.clear();
     }
 }
 
+void JsonOut::end_value()
+{
+    need_separator = true;
+    if (nesting == 0 || buffer.size() >= json_out_flush_size) {
+        flush();
+    }
+}
+
+void JsonOut::reserve_buffer()
+{
+    buffer.reserve(json_out_flush_size);
+}
+
+void JsonOut::write_indent()
+{
+    buffer.append(indent_level * 4, ' ');
+}
+
 void JsonOut::write_separator()
 {
-    stream->put(',');
+    buffer += ',';
     if (pretty_print) {
-        stream->put('\n');
+        buffer += '\n';
         write_indent();
     }
     need_separator = false;
@@ -1590,9 +1622,9 @@ void JsonOut::write_separator()
 void JsonOut::write_member_separator()
 {
     if (pretty_print) {
-        stream->write(" : ", 3);
+        buffer += " : ";
     } else {
-        stream->put(':');
+        buffer += ':';
     }
     need_separator = false;
 }
@@ -1602,10 +1634,11 @@ void JsonOut::start_object()
     if (need_separator) {
         write_separator();
     }
-    stream->put('{');
+    buffer += '{';
+    nesting++;
     if (pretty_print) {
         indent_level += 1;
-        stream->put('\n');
+        buffer += '\n';
         write_indent();
     }
     need_separator = false;
@@ -1615,11 +1648,12 @@ void JsonOut::end_object()
 {
     if (pretty_print) {
         indent_level -= 1;
-        stream->put('\n');
+        buffer += '\n';
         write_indent();
     }
-    stream->put('}');
-    need_separator = true;
+    buffer += '}';
+    nesting--;
+    end_value();
 }
 
 void JsonOut::start_array()
@@ -1627,10 +1661,11 @@ void JsonOut::start_array()
     if (need_separator) {
         write_separator();
     }
-    stream->put('[');
+    buffer += '[';
+    nesting++;
     if (pretty_print) {
         indent_level += 1;
-        stream->put('\n');
+        buffer += '\n';
         write_indent();
     }
     need_separator = false;
@@ -1640,11 +1675,12 @@ void JsonOut::end_array()
 {
     if (pretty_print) {
         indent_level -= 1;
-        stream->put('\n');
+        buffer += '\n';
         write_indent();
     }
-    stream->put(']');
-    need_separator = true;
+    buffer += ']';
+    nesting--;
+    end_value();
 }
 
 void JsonOut::write_null()
@@ -1652,8 +1688,8 @@ void JsonOut::write_null()
     if (need_separator) {
         write_separator();
     }
-    stream->write("null", 4);
-    need_separator = true;
+    buffer += "null";
+    end_value();
 }
 
 void JsonOut::write(const bool &b)
@@ -1662,11 +1698,35 @@ void JsonOut::write(const bool &b)
         write_separator();
     }
     if (b) {
-        stream->write("true", 4);
+        buffer += "true";
     } else {
-        stream->write("false", 5);
+        buffer += "false";
+    }
+    end_value();
+}
+
+// Appends the decimal digits of value to the buffer.
+static void append_unsigned(std::string &buffer, unsigned long value)
+{
+    char digits[24];
+    char *const end = digits + sizeof(digits);
+    char *p = end;
+    do {
+        *--p = '0' + value % 10;
+        value /= 10;
+    } while (value != 0);
+    buffer.append(p, end - p);
+}
+
+static void append_signed(std::string &buffer, long value)
+{
+    if (value < 0) {
+        buffer += '-';
+        // negate as unsigned, so the smallest long doesn't overflow
+        append_unsigned(buffer, 0UL - static_cast<unsigned long>(value));
+    } else {
+        append_unsigned(buffer, value);
     }
-    need_separator = true;
 }
 
 void JsonOut::write(const int &i)
@@ -1674,9 +1734,8 @@ void JsonOut::write(const int &i)
     if (need_separator) {
         write_separator();
     }
-    // format specified in constructor, let's hope it hasn't changed
-    *stream << i;
-    need_separator = true;
+    append_signed(buffer, i);
+    end_value();
 }
 
 void JsonOut::write(const unsigned &u)
@@ -1684,9 +1743,8 @@ void JsonOut::write(const unsigned &u)
     if (need_separator) {
         write_separator();
     }
-    // format specified in constructor, let's hope it hasn't changed
-    *stream << u;
-    need_separator = true;
+    append_unsigned(buffer, u);
+    end_value();
 }
 
 void JsonOut::write(const long &l)
@@ -1694,9 +1752,8 @@ void JsonOut::write(const long &l)
     if (need_separator) {
         write_separator();
     }
-    // format specified in constructor, let's hope it hasn't changed
-    *stream << l;
-    need_separator = true;
+    append_signed(buffer, l);
+    end_value();
 }
 
 void JsonOut::write(const unsigned long &ul)
@@ -1704,9 +1761,8 @@ void JsonOut::write(const unsigned long &ul)
     if (need_separator) {
         write_separator();
     }
-    // format specified in constructor, let's hope it hasn't changed
-    *stream << ul;
-    need_separator = true;
+    append_unsigned(buffer, ul);
+    end_value();
 }
 
 void JsonOut::write(const double &f)
@@ -1714,9 +1770,17 @@ void JsonOut::write(const double &f)
     if (need_separator) {
         write_separator();
     }
-    // format specified in constructor, let's hope it hasn't changed
-    *stream << f;
-    need_separator = true;
+    // same format as the scientific stream output that was used before
+    char formatted[64];
+    const int len = snprintf(formatted, sizeof(formatted), "%e", f);
+    for (int i = 0; i < len; i++) {
+        // the C locale might use a decimal comma
+        if (formatted[i] == ',') {
+            formatted[i] = '.';
+        }
+    }
+    buffer.append(formatted, len);
+    end_value();
 }
 
 void JsonOut::write(const std::string &s)
@@ -1725,42 +1789,42 @@ void JsonOut::write(const std::string &s)
         write_separator();
     }
     unsigned char ch;
-    stream->put('"');
+    buffer += '"';
     for (auto &i : s) {
         ch = i;
         if (ch == '"') {
-            stream->write("\\\"", 2);
+            buffer += "\\\"";
         } else if (ch == '\\') {
-            stream->write("\\\\", 2);
+            buffer += "\\\\";
         } else if (ch == '/') {
             // don't technically need to escape this
-            stream->put('/');
+            buffer += '/';
         } else if (ch == '\b') {
-            stream->write("\\b", 2);
+            buffer += "\\b";
         } else if (ch == '\f') {
-            stream->write("\\f", 2);
+            buffer += "\\f";
         } else if (ch == '\n') {
-            stream->write("\\n", 2);
+            buffer += "\\n";
         } else if (ch == '\r') {
-            stream->write("\\r", 2);
+            buffer += "\\r";
         } else if (ch == '\t') {
-            stream->write("\\t", 2);
+            buffer += "\\t";
         } else if (ch < 0x20) {
             // convert to "\uxxxx" unicode escape
-            stream->write("\\u00", 4);
-            stream->put((ch < 0x10) ? '0' : '1');
+            buffer += "\\u00";
+            buffer += (ch < 0x10) ? '0' : '1';
             char remainder = ch & 0x0F;
             if (remainder < 0x0A) {
-                stream->put('0' + remainder);
+                buffer += '0' + remainder;
             } else {
-                stream->put('A' + (remainder - 0x0A));
+                buffer += 'A' + (remainder - 0x0A);
             }
         } else {
-            stream->put(ch);
+            buffer += ch;
         }
     }
-    stream->put('"');
-    need_separator = true;
+    buffer += '"';
+    end_value();
 }
 
 template<size_t N>
@@ -1769,15 +1833,10 @@ void JsonOut::write(const std::bitset<N> &b)
     if (need_separator) {
         write_separator();
     }
-    std::string converted = b.to_string();
-    unsigned char ch;
-    stream->put('"');
-    for (auto &i : converted) {
-        ch = i;
-        stream->put(ch);
-    }
-    stream->put('"');
-    need_separator = true;
+    buffer += '"';
+    buffer += b.to_string();
+    buffer += '"';
+    end_value();
 }
 
 void JsonOut::write(const JsonSerializer &thing)
@@ -1786,7 +1845,7 @@ void JsonOut::write(const JsonSerializer &thing)
         write_separator();
     }
     thing.serialize(*this);
-    need_separator = true;
+    end_value();
 }
 
 void JsonOut::member(const std::string &name)
@@ -339,6 +339,13 @@ class JsonIn
  * and the constructor also has an option for crude pretty-printing,
  * which inserts newlines and whitespace liberally, if turned on.
  *
+ * The output is formatted into a buffer (without going through the
+ * locale dependent stream operators) and written to the stream in large
+ * blocks. The buffer is written out whenever a top-level value is
+ * complete, so the stream can be used directly between top-level values,
+ * and when the JsonOut is destroyed. Use flush() to write it out at any
+ * other point.
+ *
  * Basic containers such as maps, sets and vectors,
  * as well as anything inheriting the JsonSerializer interface,
  * can be serialized automatically by write() and member().
@@ -347,12 +354,27 @@ class JsonOut
 {
     private:
         std::ostream *stream;
+        std::string buffer;
         bool pretty_print;
         bool need_separator;
         int indent_level;
+        // number of objects and arrays that have been started but not ended
+        int nesting;
+
+        // write the buffer to the stream if a top-level value is complete
+        // or the buffer has grown large enough
+        void end_value();
 
     public:
         JsonOut(std::ostream &stream, bool pretty_print = false);
+        JsonOut(const JsonOut &) = delete;
+        JsonOut &operator=(const JsonOut &) = delete;
+        ~JsonOut();
+
+        // write the buffered output to the stream
+        void flush();
+        // allocate the whole buffer up front, for writers of large files
+        void reserve_buffer();
 
         // punctuation
         void write_indent();
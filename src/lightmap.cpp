@@ -5,6 +5,7 @@
 #include "options.h"
 
 #include <cmath>
+#include <algorithm>
 
 #define INBOUNDS(x, y) \
     (x >= 0 && x < SEEX * MAPSIZE && y >= 0 && y < SEEY * MAPSIZE)
@@ -24,29 +25,37 @@ void map::add_light_from_items( const int x, const int y, std::list<item>::itera
         int idir = 0;   // otherwise, it's a light_arc pointed in this direction
         if( itm_it->getlight( ilum, iwidth, idir ) ) {
             if( iwidth > 0 ) {
-                apply_light_arc( x, y, idir, ilum, iwidth );
+                queue_light( light_op::APPLY_ARC, x, y, ilum, trigdist, idir, iwidth );
             } else {
-                add_light_source( x, y, ilum );
+                queue_light( light_op::ADD_SOURCE, x, y, ilum );
             }
         }
     }
 }
 
 // TODO Consider making this just clear the cache and dynamically fill it in as trans() is called
-void map::build_transparency_cache()
+bool map::build_transparency_cache()
 {
-    if( !transparency_cache_dirty ) {
-        return;
+    const bool partly_dirty = std::find( transparency_submaps_dirty.begin(),
+                                         transparency_submaps_dirty.end(),
+                                         true ) != transparency_submaps_dirty.end();
+    if( !transparency_cache_dirty && !partly_dirty ) {
+        return false;
     }
 
-    // Default to fully transparent.
-    std::uninitialized_fill_n(
-        &transparency_cache[0][0], MAPSIZE*SEEX * MAPSIZE*SEEY, LIGHT_TRANSPARENCY_CLEAR);
+    if( transparency_cache_dirty ) {
+        // Default to fully transparent.
+        std::uninitialized_fill_n(
+            &transparency_cache[0][0], MAPSIZE*SEEX * MAPSIZE*SEEY, LIGHT_TRANSPARENCY_CLEAR);
+    }
 
     // Traverse the submaps in order
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
-            auto const cur_submap = get_submap_at_grid( smx, smy );
+            if( !transparency_cache_dirty && !transparency_submaps_dirty[smx + smy * my_MAPSIZE] ) {
+                continue;
+            }
+            const submap *const cur_submap = get_submap_at_grid( smx, smy );
 
             for( int sx = 0; sx < SEEX; ++sx ) {
                 for( int sy = 0; sy < SEEY; ++sy ) {
@@ -54,14 +63,15 @@ void map::build_transparency_cache()
                     const int y = sy + smy * SEEY;
 
                     auto &value = transparency_cache[x][y];
+                    value = LIGHT_TRANSPARENCY_CLEAR;
 
-                    if( !(terlist [cur_submap->ter[sx][sy]].transparent &&
-                          furnlist[cur_submap->frn[sx][sy]].transparent) ) {
+                    if( !(terlist [cur_submap->get_ter( sx, sy )].transparent &&
+                          furnlist[cur_submap->get_furn( sx, sy )].transparent) ) {
                         value = LIGHT_TRANSPARENCY_SOLID;
                         continue;
                     }
 
-                    for( auto const &fld : cur_submap->fld[sx][sy] ) {
+                    for( auto const &fld : cur_submap->get_field( sx, sy ) ) {
                         const field_entry &cur = fld.second;
                         const field_id type = cur.getFieldType();
                         const int density = cur.getFieldDensity();
@@ -103,22 +113,15 @@ void map::build_transparency_cache()
         }
     }
     transparency_cache_dirty = false;
+    std::fill( transparency_submaps_dirty.begin(), transparency_submaps_dirty.end(), false );
+    return true;
 }
 
-void map::generate_lightmap()
+void map::generate_lightmap( const bool caches_changed )
 {
-    memset(lm, 0, sizeof(lm));
-    memset(sm, 0, sizeof(sm));
-
-    /* Bulk light sources wastefully cast rays into neighbors; a burning hospital can produce
-         significant slowdown, so for stuff like fire and lava:
-     * Step 1: Store the position and luminance in buffer via add_light_source, for efficient
-         checking of neighbors.
-     * Step 2: After everything else, iterate buffer and apply_light_source only in non-redundant
-         directions
-     * Step 3: Profit!
-     */
-    memset(light_source_buffer, 0, sizeof(light_source_buffer));
+    // All light sources are first recorded in light_ops (see queue_light), the lightmap is
+    // only computed from them if they or the caches the light rays depend on have changed.
+    light_ops.clear();
 
     constexpr int dir_x[] = {  0, -1 , 1, 0 };   //    [0]
     constexpr int dir_y[] = { -1,  0 , 0, 1 };   // [1][X][2]
@@ -135,11 +138,11 @@ void map::generate_lightmap()
             for (int sy = DAYLIGHT_LEVEL - hl; sy < LIGHTMAP_CACHE_Y - hl; ++sy) {
                 // In bright light indoor light exists to some degree
                 if (!is_outside(sx, sy)) {
-                    lm[sx][sy] = LIGHT_AMBIENT_LOW;
+                    queue_light( light_op::SET_LIGHT, sx, sy, LIGHT_AMBIENT_LOW );
                 } else if (g->u.posx() == sx && g->u.posy() == sy ) {
                     //Only apply daylight on square where player is standing to avoid flooding
                     // the lightmap  when in less than total sunlight.
-                    lm[sx][sy] = natural_light;
+                    queue_light( light_op::SET_LIGHT, sx, sy, natural_light );
                 }
             }
         }
@@ -147,7 +150,7 @@ void map::generate_lightmap()
 
     // Apply player light sources
     if (held_luminance > LIGHT_AMBIENT_LOW) {
-        apply_light_source(g->u.posx(), g->u.posy(), held_luminance, trigdist);
+        queue_light( light_op::APPLY_SOURCE, g->u.posx(), g->u.posy(), held_luminance, trigdist );
     }
 
     // LIGHTMAP_CACHE_X = MAPSIZE * SEEX
@@ -155,7 +158,7 @@ void map::generate_lightmap()
     // Traverse the submaps in order
     for (int smx = 0; smx < my_MAPSIZE; ++smx) {
         for (int smy = 0; smy < my_MAPSIZE; ++smy) {
-            auto const cur_submap = get_submap_at_grid( smx, smy );
+            const submap *const cur_submap = get_submap_at_grid( smx, smy );
 
             for (int sx = 0; sx < SEEX; ++sx) {
                 for (int sy = 0; sy < SEEY; ++sy) {
@@ -169,74 +172,75 @@ void map::generate_lightmap()
                         for(int i = 0; i < 4; ++i) {
                             if (INBOUNDS(x + dir_x[i], y + dir_y[i]) &&
                                 is_outside(x + dir_x[i], y + dir_y[i])) {
-                                lm[x][y] = natural_light;
+                                queue_light( light_op::SET_LIGHT, x, y, natural_light );
 
                                 if (light_transparency(x, y) > LIGHT_TRANSPARENCY_SOLID) {
-                                    apply_light_arc(x, y, dir_d[i], natural_light);
+                                    queue_light( light_op::APPLY_ARC, x, y, natural_light, trigdist,
+                                                 dir_d[i] );
                                 }
                             }
                         }
                     }
 
-                    if (cur_submap->lum[sx][sy]) {
+                    if (cur_submap->get_lum( sx, sy )) {
                         auto items = i_at(x, y);
                         add_light_from_items(x, y, items.begin(), items.end());
                     }
 
-                    const ter_id terrain = cur_submap->ter[sx][sy];
+                    const ter_id terrain = cur_submap->get_ter( sx, sy );
                     if (terrain == t_lava) {
-                        add_light_source(x, y, 50 );
+                        queue_light( light_op::ADD_SOURCE, x, y, 50 );
                     } else if (terrain == t_console) {
-                        add_light_source(x, y, 3 );
+                        queue_light( light_op::ADD_SOURCE, x, y, 3 );
                     } else if (terrain == t_utility_light) {
-                        add_light_source(x, y, 35 );
+                        queue_light( light_op::ADD_SOURCE, x, y, 35 );
                     }
 
-                    for( auto &fld : cur_submap->fld[sx][sy] ) {
+                    for( auto &fld : cur_submap->get_field( sx, sy ) ) {
                         const field_entry *cur = &fld.second;
                         // TODO: [lightmap] Attach light brightness to fields
                         switch(cur->getFieldType()) {
                         case fd_fire:
                             if (3 == cur->getFieldDensity()) {
-                                add_light_source(x, y, 160);
+                                queue_light( light_op::ADD_SOURCE, x, y, 160 );
                             } else if (2 == cur->getFieldDensity()) {
-                                add_light_source(x, y, 60);
+                                queue_light( light_op::ADD_SOURCE, x, y, 60 );
                             } else {
-                                add_light_source(x, y, 16);
+                                queue_light( light_op::ADD_SOURCE, x, y, 16 );
                             }
                             break;
                         case fd_fire_vent:
                         case fd_flame_burst:
-                            add_light_source(x, y, 8);
+                            queue_light( light_op::ADD_SOURCE, x, y, 8 );
                             break;
                         case fd_electricity:
                         case fd_plasma:
                             if (3 == cur->getFieldDensity()) {
-                                add_light_source(x, y, 8);
+                                queue_light( light_op::ADD_SOURCE, x, y, 8 );
                             } else if (2 == cur->getFieldDensity()) {
-                                add_light_source(x, y, 1);
+                                queue_light( light_op::ADD_SOURCE, x, y, 1 );
                             } else {
-                                apply_light_source(x, y, LIGHT_SOURCE_LOCAL,
-                                                   trigdist);    // kinda a hack as the square will still get marked
+                                // kinda a hack as the square will still get marked
+                                queue_light( light_op::APPLY_SOURCE, x, y, LIGHT_SOURCE_LOCAL, trigdist );
                             }
                             break;
                         case fd_incendiary:
                             if (3 == cur->getFieldDensity()) {
-                                add_light_source(x, y, 30);
+                                queue_light( light_op::ADD_SOURCE, x, y, 30 );
                             } else if (2 == cur->getFieldDensity()) {
-                                add_light_source(x, y, 16);
+                                queue_light( light_op::ADD_SOURCE, x, y, 16 );
                             } else {
-                                add_light_source(x, y, 8);
+                                queue_light( light_op::ADD_SOURCE, x, y, 8 );
                             }
                             break;
                         case fd_laser:
-                            apply_light_source(x, y, 1, trigdist);
+                            queue_light( light_op::APPLY_SOURCE, x, y, 1, trigdist );
                             break;
                         case fd_spotlight:
-                            add_light_source(x, y, 20);
+                            queue_light( light_op::ADD_SOURCE, x, y, 20 );
                             break;
                         case fd_dazzling:
-                            add_light_source(x, y, 2);
+                            queue_light( light_op::ADD_SOURCE, x, y, 2 );
                             break;
                         default:
                             //Suppress warnings
@@ -257,13 +261,13 @@ void map::generate_lightmap()
         int my = critter.posy();
         if (INBOUNDS(mx, my)) {
             if (critter.has_effect("onfire")) {
-                apply_light_source(mx, my, 3, trigdist);
+                queue_light( light_op::APPLY_SOURCE, mx, my, 3, trigdist );
             }
             // TODO: [lightmap] Attach natural light brightness to creatures
             // TODO: [lightmap] Allow creatures to have light attacks (ie: eyebot)
             // TODO: [lightmap] Allow creatures to have facing and arc lights
             if (critter.type->luminance > 0) {
-                apply_light_source(mx, my, critter.type->luminance, trigdist);
+                queue_light( light_op::APPLY_SOURCE, mx, my, critter.type->luminance, trigdist );
             }
         }
     }
@@ -286,9 +290,9 @@ void map::generate_lightmap()
                     int px = vv.x + v->parts[light_indice].precalc[0].x;
                     int py = vv.y + v->parts[light_indice].precalc[0].y;
                     if(INBOUNDS(px, py)) {
-                        add_light_source(px, py, SQRT_2); // Add a little surrounding light
-                        apply_light_arc( px, py, dir + v->parts[light_indice].direction,
-                                         veh_luminance, 45 );
+                        queue_light( light_op::ADD_SOURCE, px, py, SQRT_2 ); // Add a little surrounding light
+                        queue_light( light_op::APPLY_ARC, px, py, veh_luminance, trigdist,
+                                     dir + v->parts[light_indice].direction, 45 );
                     }
                 }
             }
@@ -305,7 +309,7 @@ void map::generate_lightmap()
                     int px = vv.x + v->parts[light_indice].precalc[0].x;
                     int py = vv.y + v->parts[light_indice].precalc[0].y;
                     if(INBOUNDS(px, py)) {
-                        add_light_source( px, py, v->part_info( light_indice ).bonus );
+                        queue_light( light_op::ADD_SOURCE, px, py, v->part_info( light_indice ).bonus );
                     }
                 }
             }
@@ -317,7 +321,7 @@ void map::generate_lightmap()
                 int px = vv.x + v->parts[light_indice].precalc[0].x;
                 int py = vv.y + v->parts[light_indice].precalc[0].y;
                 if(INBOUNDS(px, py)) {
-                    add_light_source( px, py, v->part_info( light_indice ).bonus );
+                    queue_light( light_op::ADD_SOURCE, px, py, v->part_info( light_indice ).bonus );
                 }
             }
         }
@@ -327,7 +331,7 @@ void map::generate_lightmap()
                 int px = vv.x + v->parts[light_indice].precalc[0].x;
                 int py = vv.y + v->parts[light_indice].precalc[0].y;
                 if(INBOUNDS(px, py)) {
-                    add_light_source( px, py, v->part_info( light_indice ).bonus );
+                    queue_light( light_op::ADD_SOURCE, px, py, v->part_info( light_indice ).bonus );
                 }
             }
         }
@@ -343,6 +347,51 @@ void map::generate_lightmap()
         }
     }
 
+    if( g->u.has_active_bionic( "bio_night" ) ) {
+        queue_light( light_op::NIGHT_VISION, g->u.posx(), g->u.posy(), 0 );
+    }
+
+    if( !caches_changed && light_ops == applied_light_ops ) {
+        // Same lights shining through the same map as last time.
+        return;
+    }
+
+    memset(lm, 0, sizeof(lm));
+    memset(sm, 0, sizeof(sm));
+
+    /* Bulk light sources wastefully cast rays into neighbors; a burning hospital can produce
+         significant slowdown, so for stuff like fire and lava:
+     * Step 1: Store the position and luminance in buffer via add_light_source, for efficient
+         checking of neighbors.
+     * Step 2: After everything else, iterate buffer and apply_light_source only in non-redundant
+         directions
+     * Step 3: Profit!
+     */
+    memset(light_source_buffer, 0, sizeof(light_source_buffer));
+
+    // The buffered light sources added so far are visible to the light that is applied
+    // immediately, so the operations must be replayed in the order they were recorded.
+    bool night_vision = false;
+    for( const auto &op : light_ops ) {
+        switch( op.type ) {
+        case light_op::SET_LIGHT:
+            lm[op.x][op.y] = op.luminance;
+            break;
+        case light_op::ADD_SOURCE:
+            add_light_source( op.x, op.y, op.luminance );
+            break;
+        case light_op::APPLY_SOURCE:
+            apply_light_source( op.x, op.y, op.luminance, op.trig_brightcalc );
+            break;
+        case light_op::APPLY_ARC:
+            apply_light_arc( op.x, op.y, op.angle, op.luminance, op.wideangle );
+            break;
+        case light_op::NIGHT_VISION:
+            night_vision = true;
+            break;
+        }
+    }
+
     /* Now that we have position and intensity of all bulk light sources, apply_ them
       This may seem like extra work, but take a 12x12 raging inferno:
         unbuffered: (12^2)*(160*4) = apply_light_ray x 92160
@@ -358,7 +407,7 @@ void map::generate_lightmap()
     }
 
 
-    if (g->u.has_active_bionic("bio_night") ) {
+    if( night_vision ) {
         for(int sx = 0; sx < LIGHTMAP_CACHE_X; ++sx) {
             for(int sy = 0; sy < LIGHTMAP_CACHE_Y; ++sy) {
                 if (rl_dist(sx, sy, g->u.posx(), g->u.posy()) < 15) {
@@ -367,6 +416,14 @@ void map::generate_lightmap()
             }
         }
     }
+    std::swap( light_ops, applied_light_ops );
+}
+
+void map::queue_light( const light_op::op_type type, const int x, const int y,
+                       const float luminance, const bool trig_brightcalc, const int angle,
+                       const int wideangle )
+{
+    light_ops.push_back( light_op{ type, x, y, luminance, trig_brightcalc, angle, wideangle } );
 }
 
 void map::add_light_source(int x, int y, float luminance )
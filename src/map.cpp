@@ -13,10 +13,12 @@
 #include "debug.h"
 #include "messages.h"
 #include "mapsharing.h"
+#include "turn_profiler.h"
 
 #include <cmath>
 #include <stdlib.h>
 #include <fstream>
+#include <algorithm>
 
 extern bool is_valid_in_w_terrain(int,int);
 
@@ -125,7 +127,20 @@ map::map(int mapsize)
     veh_in_active_range = true;
     transparency_cache_dirty = true;
     outside_cache_dirty = true;
-    memset(veh_exists_at, 0, sizeof(veh_exists_at));
+    seen_cache_origin = point( -1, -1 );
+    pregen_key.fill( 0 );
+    last_shift = point( 0, 0 );
+    // An empty lightmap, as generate_lightmap would compute it without any light sources.
+    memset( lm, 0, sizeof( lm ) );
+    memset( sm, 0, sizeof( sm ) );
+    memset( last_outside_cache, false, sizeof( last_outside_cache ) );
+    memset( last_transparency_cache, 0, sizeof( last_transparency_cache ) );
+    veh_cached_parts.resize( SEEX * my_MAPSIZE * SEEY * my_MAPSIZE,
+                             std::pair<vehicle *, int>( nullptr, -1 ) );
+    pathing_cache.resize( SEEX * my_MAPSIZE * SEEY * my_MAPSIZE );
+    pathing_cache_dirty.resize( my_MAPSIZE * my_MAPSIZE, true );
+    transparency_submaps_dirty.resize( my_MAPSIZE * my_MAPSIZE, false );
+    outside_submaps_dirty.resize( my_MAPSIZE * my_MAPSIZE, false );
     traplocs.resize( traplist.size() );
 }
 
@@ -185,18 +200,15 @@ const vehicle* map::veh_at(const int x, const int y, int &part_num) const
 const vehicle* map::veh_at_internal( const int x, const int y, int &part_num) const
 {
     // This function is called A LOT. Move as much out of here as possible.
-    if( !veh_in_active_range || !veh_exists_at[x][y] ) {
-        return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
+    if( !veh_in_active_range ) {
+        return nullptr;
     }
 
-    const auto it = veh_cached_parts.find( point( x, y ) );
-    if( it != veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
+    const auto &entry = veh_cached_parts[x + y * SEEX * my_MAPSIZE];
+    if( entry.first != nullptr ) {
+        part_num = entry.second;
     }
-
-    debugmsg( "vehicle part cache cache indicated vehicle not found: %d %d", x, y );
-    return nullptr;
+    return entry.first;
 }
 
 point map::veh_part_coordinates(const int x, const int y)
@@ -233,28 +245,49 @@ void map::reset_vehicle_cache()
     }
 }
 
-void map::update_vehicle_cache( vehicle *veh, const bool brand_new )
+void map::uncache_vehicle( const vehicle *veh )
 {
-    veh_in_active_range = true;
-    if( !brand_new ) {
-        // Existing must be cleared
-        auto it = veh_cached_parts.begin();
-        const auto end = veh_cached_parts.end();
-        while( it != end ) {
+    const auto tiles = veh_cached_tiles.find( veh );
+    if( tiles == veh_cached_tiles.end() ) {
+        return;
+    }
+    for( const point &p : tiles->second ) {
+        auto &entry = veh_cached_parts[p.x + p.y * SEEX * my_MAPSIZE];
+        // The vehicle's own overlapping entry must go first, it must not take over the tile
+        // from itself.
+        auto overlapping = veh_overlapping_parts.equal_range( p );
+        for( auto it = overlapping.first; it != overlapping.second; ) {
             if( it->second.first == veh ) {
-                const auto &p = it->first;
-                if( inbounds( p.x, p.y ) ) {
-                    veh_exists_at[p.x][p.y] = false;
-                }
-                veh_cached_parts.erase( it++ );
+                it = veh_overlapping_parts.erase( it );
             } else {
                 ++it;
             }
         }
+        if( entry.first != veh ) {
+            continue;
+        }
+        overlapping = veh_overlapping_parts.equal_range( p );
+        if( overlapping.first != overlapping.second ) {
+            // Another vehicle is on this tile as well, it takes over the tile.
+            entry = overlapping.first->second;
+            veh_overlapping_parts.erase( overlapping.first );
+        } else {
+            entry = std::make_pair( nullptr, -1 );
+        }
     }
+    veh_cached_tiles.erase( tiles );
+}
+
+void map::update_vehicle_cache( vehicle *veh, bool )
+{
+    veh_in_active_range = true;
+    // Existing entries must be cleared. That's a single lookup now, so it's also done for
+    // brand new vehicles, some callers pass that for vehicles that might have been cached.
+    uncache_vehicle( veh );
     // Get parts
     std::vector<vehicle_part> &parts = veh->parts;
     const point gpos = veh->global_pos();
+    std::vector<point> &tiles = veh_cached_tiles[veh];
     int partid = 0;
     for( std::vector<vehicle_part>::iterator it = parts.begin(),
          end = parts.end(); it != end; ++it, ++partid ) {
@@ -262,24 +295,42 @@ void map::update_vehicle_cache( vehicle *veh, const bool brand_new )
             continue;
         }
         const point p = gpos + it->precalc[0];
-        veh_cached_parts.insert( std::make_pair( p,
-                                 std::make_pair( veh, partid ) ) );
-        if( inbounds( p.x, p.y ) ) {
-            veh_exists_at[p.x][p.y] = true;
+        if( !inbounds( p.x, p.y ) ) {
+            // veh_at never looks outside of the map.
+            continue;
+        }
+        auto &entry = veh_cached_parts[p.x + p.y * SEEX * my_MAPSIZE];
+        if( entry.first == veh ) {
+            // Several parts on one tile, the first one is cached.
+            continue;
+        }
+        if( entry.first == nullptr ) {
+            entry = std::make_pair( veh, partid );
+        } else {
+            // At most one entry per vehicle and tile, like in veh_cached_parts.
+            const auto overlapping = veh_overlapping_parts.equal_range( p );
+            const bool cached = std::any_of( overlapping.first, overlapping.second,
+            [veh]( const std::pair<const point, std::pair<vehicle *, int>> &other ) {
+                return other.second.first == veh;
+            } );
+            if( cached ) {
+                continue;
+            }
+            veh_overlapping_parts.insert( std::make_pair( p, std::make_pair( veh, partid ) ) );
         }
+        tiles.push_back( p );
     }
 }
 
 void map::clear_vehicle_cache()
 {
-    while( veh_cached_parts.size() ) {
-        const auto part = veh_cached_parts.begin();
-        const auto &p = part->first;
-        if( inbounds( p.x, p.y ) ) {
-            veh_exists_at[p.x][p.y] = false;
+    for( const auto &tiles : veh_cached_tiles ) {
+        for( const point &p : tiles.second ) {
+            veh_cached_parts[p.x + p.y * SEEX * my_MAPSIZE] = std::make_pair( nullptr, -1 );
         }
-        veh_cached_parts.erase( part );
     }
+    veh_cached_tiles.clear();
+    veh_overlapping_parts.clear();
 }
 
 void map::update_vehicle_list( submap *const to )
@@ -383,7 +434,7 @@ void map::destroy_vehicle (vehicle *veh)
     for (size_t i = 0; i < current_submap->vehicles.size(); i++) {
         if (current_submap->vehicles[i] == veh) {
             vehicle_list.erase(veh);
-            reset_vehicle_cache();
+            uncache_vehicle( veh );
             current_submap->vehicles.erase (current_submap->vehicles.begin() + i);
             delete veh;
             return;
@@ -535,8 +586,8 @@ bool map::displace_vehicle (int &x, int &y, const int dx, const int dy, bool tes
 }
 
 void map::on_vehicle_moved() {
-    set_outside_cache_dirty();
-    set_transparency_cache_dirty();
+    // Vehicle parts are stamped onto the outside and transparency caches in build_map_cache,
+    // which notices when they have moved, the terrain underneath hasn't changed.
 }
 
 void map::vehmove()
@@ -1102,8 +1153,9 @@ void map::furn_set(const int x, const int y, const furn_id new_furniture)
 
  // set the dirty flags
  // TODO: consider checking if the transparency value actually changes
- set_transparency_cache_dirty();
+ set_transparency_cache_dirty( x / SEEX, y / SEEY );
  current_submap->set_furn(lx, ly, new_furniture);
+ update_pathing_tile( x, y );
 }
 
 void map::furn_set(const int x, const int y, const std::string new_furniture) {
@@ -1208,12 +1260,13 @@ void map::ter_set(const int x, const int y, const ter_id new_terrain) {
 
     // set the dirty flags
     // TODO: consider checking if the transparency value actually changes
-    set_transparency_cache_dirty();
-    set_outside_cache_dirty();
+    set_transparency_cache_dirty( x / SEEX, y / SEEY );
+    set_outside_cache_dirty( x / SEEX, y / SEEY );
 
     int lx, ly;
     submap * const current_submap = get_submap_at(x, y, lx, ly);
     current_submap->set_ter( lx, ly, new_terrain );
+    update_pathing_tile( x, y );
 }
 
 std::string map::tername(const int x, const int y) const
@@ -1256,19 +1309,18 @@ int map::move_cost(const int x, const int y, const vehicle *ignored_vehicle) con
     }
 
     int part;
-    const furn_t &furniture = furn_at( x, y );
-    const ter_t &terrain = ter_at( x, y );
-    const vehicle *veh = veh_at( x, y, part );
+    const vehicle *veh = veh_at_internal( x, y, part );
     if( veh == ignored_vehicle ) {
         veh = nullptr;
     }
 
-    return move_cost_internal( furniture, terrain, veh, part );
+    return move_cost_internal( x, y, veh, part );
 }
 
-int map::move_cost_internal(const furn_t &furniture, const ter_t &terrain, const vehicle *veh, const int vpart) const
+int map::move_cost_internal( const int x, const int y, const vehicle *veh, const int vpart ) const
 {
-    if( terrain.movecost == 0 || ( furniture.loadid != f_null && furniture.movecost < 0 ) ) {
+    const pathing_tile &tile = pathing_at( x, y );
+    if( ( tile.flags & PF_BLOCKED ) != 0 ) {
         return 0;
     }
 
@@ -1285,11 +1337,84 @@ int map::move_cost_internal(const furn_t &furniture, const ter_t &terrain, const
         }
     }
 
-    if( furniture.loadid != f_null ) {
-        return std::max( terrain.movecost + furniture.movecost, 0 );
+    return tile.cost;
+}
+
+const pathing_tile &map::pathing_at( const int x, const int y ) const
+{
+    const size_t grididx = x / SEEX + ( y / SEEY ) * my_MAPSIZE;
+    if( pathing_cache_dirty[grididx] ) {
+        pathing_cache_dirty[grididx] = false;
+        const int startx = x - x % SEEX;
+        const int starty = y - y % SEEY;
+        for( int sx = startx; sx < startx + SEEX; sx++ ) {
+            for( int sy = starty; sy < starty + SEEY; sy++ ) {
+                update_pathing_tile( sx, sy );
+            }
+        }
+    }
+    return pathing_cache[x + y * SEEX * my_MAPSIZE];
+}
+
+void map::update_pathing_tile( const int x, const int y ) const
+{
+    const furn_t &furniture = furn_at( x, y );
+    const ter_t &terrain = ter_at( x, y );
+    const bool has_furniture = furniture.loadid != f_null;
+    pathing_tile &tile = pathing_cache[x + y * SEEX * my_MAPSIZE];
+    tile.flags = 0;
+
+    if( terrain.movecost == 0 || ( has_furniture && furniture.movecost < 0 ) ) {
+        tile.flags |= PF_BLOCKED;
+        tile.cost = 0;
+    } else {
+        const int cost = terrain.movecost + ( has_furniture ? furniture.movecost : 0 );
+        tile.cost = std::min( std::max( cost, 0 ), 255 );
     }
 
-    return std::max( terrain.movecost, 0 );
+    if( terrain.bash.str_max != -1 || ( has_furniture && furniture.bash.str_max != -1 ) ) {
+        tile.flags |= PF_BASHABLE;
+    }
+    if( !terrain.open.empty() ) {
+        tile.flags |= PF_OPENABLE;
+    }
+    static const std::pair<ter_bitflags, pathing_flag> mirrored_flags[] = {
+        { TFLAG_LIQUID, PF_LIQUID },
+        { TFLAG_DEEP_WATER, PF_DEEP_WATER },
+        { TFLAG_SWIMMABLE, PF_SWIMMABLE },
+        { TFLAG_DIGGABLE, PF_DIGGABLE },
+        { TFLAG_SHARP, PF_SHARP }
+    };
+    for( const auto &flag : mirrored_flags ) {
+        if( terrain.has_flag( flag.first ) || furniture.has_flag( flag.first ) ) {
+            tile.flags |= flag.second;
+        }
+    }
+}
+
+void map::set_pathing_cache_dirty( const size_t grididx )
+{
+#ifdef ZLEVELS
+    // Submaps of all z-levels are in the grid, the cache only covers the current one.
+    pathing_cache_dirty[grididx / OVERMAP_LAYERS] = true;
+#else
+    pathing_cache_dirty[grididx] = true;
+#endif
+}
+
+void map::set_pathing_cache_dirty()
+{
+    std::fill( pathing_cache_dirty.begin(), pathing_cache_dirty.end(), true );
+}
+
+void map::set_transparency_cache_dirty( const int gridx, const int gridy )
+{
+    transparency_submaps_dirty[gridx + gridy * my_MAPSIZE] = true;
+}
+
+void map::set_outside_cache_dirty( const int gridx, const int gridy )
+{
+    outside_submaps_dirty[gridx + gridy * my_MAPSIZE] = true;
 }
 
 int map::move_cost_ter_furn(const int x, const int y) const
@@ -1371,12 +1496,14 @@ bool map::has_flag_ter_or_furn(const std::string & flag, const int x, const int
     int lx, ly;
     submap * const current_submap = get_submap_at(x, y, lx, ly);
 
-    return ( terlist[ current_submap->get_ter( lx, ly ) ].has_flag(flag) || furnlist[ current_submap->get_furn(lx, ly) ].has_flag(flag) );
+    const int flag_id = map_flag_id( flag );
+    return ( terlist[ current_submap->get_ter( lx, ly ) ].has_flag_id(flag_id) || furnlist[ current_submap->get_furn(lx, ly) ].has_flag_id(flag_id) );
 }
 
 bool map::has_flag_ter_and_furn(const std::string & flag, const int x, const int y) const
 {
- return ter_at(x, y).has_flag(flag) && furn_at(x, y).has_flag(flag);
+ const int flag_id = map_flag_id( flag );
+ return ter_at(x, y).has_flag_id(flag_id) && furn_at(x, y).has_flag_id(flag_id);
 }
 /////
 bool map::has_flag(const ter_bitflags flag, const int x, const int y) const
@@ -1738,7 +1865,11 @@ void map::decay_fields_and_scent( const int amount )
                         continue;
                     }
 
-                    field &fields = cur_submap->fld[sx][sy];
+                    // Don't add empty fields to the submap by looking at every square.
+                    if( static_cast<const submap *>( cur_submap )->get_field( sx, sy ).fieldCount() == 0 ) {
+                        continue;
+                    }
+                    field &fields = cur_submap->get_field( sx, sy );
                     for( auto &fp : fields ) {
                         to_proc--;
                         field_entry &cur = fp.second;
@@ -2886,13 +3017,53 @@ map_stack map::i_at( const int x, const int y )
     int lx, ly;
     submap *const current_submap = get_submap_at( x, y, lx, ly );
 
-    return map_stack{ &current_submap->itm[lx][ly], point(x, y), this };
+    return map_stack{ &current_submap->get_items( lx, ly ), point(x, y), this };
 }
 
 bool map::sees_some_items(int x, int y, const player &u)
 {
     // can only see items if there are any items.
-    return !i_at( x, y ).empty() && could_see_items( x, y, u );
+    return has_items( x, y ) && could_see_items( x, y, u );
+}
+
+bool map::has_items( const int x, const int y ) const
+{
+    if( !INBOUNDS( x, y ) ) {
+        return false;
+    }
+
+    int lx, ly;
+    const submap *const current_submap = get_submap_at( x, y, lx, ly );
+    return !current_submap->get_items( lx, ly ).empty();
+}
+
+std::vector<point> map::points_with_items( const int x1, const int y1, const int x2, const int y2 ) const
+{
+    std::vector<point> result;
+    const int minx = std::max( x1, 0 );
+    const int miny = std::max( y1, 0 );
+    const int maxx = std::min( x2, SEEX * my_MAPSIZE - 1 );
+    const int maxy = std::min( y2, SEEY * my_MAPSIZE - 1 );
+    if( minx > maxx || miny > maxy ) {
+        return result;
+    }
+    for( int gridx = minx / SEEX; gridx <= maxx / SEEX; gridx++ ) {
+        for( int gridy = miny / SEEY; gridy <= maxy / SEEY; gridy++ ) {
+            const submap *const sm = get_submap_at_grid( gridx, gridy );
+            for( const auto &elem : sm->tile_items ) {
+                if( elem.second.empty() ) {
+                    continue;
+                }
+                const int x = gridx * SEEX + elem.first % SEEX;
+                const int y = gridy * SEEY + elem.first / SEEX;
+                if( x >= minx && x <= maxx && y >= miny && y <= maxy ) {
+                    result.push_back( point( x, y ) );
+                }
+            }
+        }
+    }
+    std::sort( result.begin(), result.end() );
+    return result;
 }
 
 bool map::could_see_items(int x, int y, const player &u) const
@@ -2947,7 +3118,7 @@ std::list<item>::iterator map::i_rem( const point location, std::list<item>::ite
 
     current_submap->update_lum_rem(*it, lx, ly);
 
-    return current_submap->itm[lx][ly].erase( it );
+    return current_submap->get_items( lx, ly ).erase( it );
 }
 
 int map::i_rem(const int x, const int y, const int index)
@@ -2985,15 +3156,15 @@ void map::i_clear(const int x, const int y)
     int lx, ly;
     submap *const current_submap = get_submap_at( x, y, lx, ly );
 
-    for( auto item_it = current_submap->itm[lx][ly].begin();
-         item_it != current_submap->itm[lx][ly].end(); ++item_it ) {
+    auto &items = current_submap->get_items( lx, ly );
+    for( auto item_it = items.begin(); item_it != items.end(); ++item_it ) {
         if( current_submap->active_items.has( item_it, point( lx, ly ) ) ) {
             current_submap->active_items.remove( item_it, point( lx, ly ) );
         }
     }
 
-    current_submap->lum[lx][ly] = 0;
-    current_submap->itm[lx][ly].clear();
+    current_submap->set_lum( lx, ly, 0 );
+    items.clear();
 }
 
 void map::spawn_an_item(const int x, const int y, item new_item,
@@ -3187,7 +3358,7 @@ void map::add_item(const int x, const int y, item new_item)
     if( new_item.needs_processing() && new_item.is_food() ) {
         new_item.process( nullptr, point(x, y), false );
     }
-    add_item_at(x, y, current_submap->itm[lx][ly].end(), new_item);
+    add_item_at(x, y, current_submap->get_items( lx, ly ).end(), new_item);
 }
 
 void map::add_item_at( const int x, const int y,
@@ -3209,7 +3380,7 @@ void map::add_item_at( const int x, const int y,
 
     current_submap->update_lum_add(new_item, lx, ly);
 
-    const auto new_pos = current_submap->itm[lx][ly].insert( index, new_item );
+    const auto new_pos = current_submap->get_items( lx, ly ).insert( index, new_item );
     if( new_item.needs_processing() ) {
         current_submap->active_items.add( new_pos, point(lx, ly) );
     }
@@ -3302,28 +3473,35 @@ void map::process_active_items()
 template<typename T>
 void map::process_items( bool const active, T processor, std::string const &signal )
 {
+    // Borrow the buffer that is reused from turn to turn. A nested call (an item
+    // processed here triggering another pass) gets an empty one instead.
+    std::vector<item_reference> active_items;
+    active_items.swap( active_item_buffer );
     for( int gx = 0; gx < my_MAPSIZE; ++gx ) {
         for( int gy = 0; gy < my_MAPSIZE; ++gy ) {
             submap *const current_submap = get_submap_at_grid(gx, gy);
             // Vehicles first in case they get blown up and drop active items on the map.
             if( !current_submap->vehicles.empty() ) {
-                process_items_in_vehicles(current_submap, processor, signal);
+                process_items_in_vehicles(current_submap, processor, signal, active_items);
             }
             if( !active || !current_submap->active_items.empty() ) {
-                process_items_in_submap(current_submap, gx, gy, processor, signal);
+                process_items_in_submap(current_submap, gx, gy, processor, signal, active_items);
             }
         }
     }
+    active_items.clear();
+    active_item_buffer.swap( active_items );
 }
 
 template<typename T>
 void map::process_items_in_submap( submap *const current_submap, int const gridx, int const gridy,
-                                   T processor, std::string const &signal )
+                                   T processor, std::string const &signal,
+                                   std::vector<item_reference> &active_items )
 {
     // Get a COPY of the active item list for this submap.
     // If more are added as a side effect of processing, they are ignored this turn.
     // If they are destroyed before processing, they don't get processed.
-    std::list<item_reference> active_items = current_submap->active_items.get();
+    current_submap->active_items.get( active_items );
     auto const grid_offset = point {gridx * SEEX, gridy * SEEY};
     for( auto &active_item : active_items ) {
         if( !current_submap->active_items.has( active_item ) ) {
@@ -3338,7 +3516,8 @@ void map::process_items_in_submap( submap *const current_submap, int const gridx
 
 template<typename T>
 void map::process_items_in_vehicles( submap *const current_submap, T processor,
-                                     std::string const &signal )
+                                     std::string const &signal,
+                                     std::vector<item_reference> &active_items )
 {
     std::vector<vehicle*> const &veh_in_nonant = current_submap->vehicles;
     // a copy, important if the vehicle list changes because a
@@ -3353,20 +3532,22 @@ void map::process_items_in_vehicles( submap *const current_submap, T processor,
             continue;
         }
 
-        process_items_in_vehicle( cur_veh, current_submap, processor, signal );
+        process_items_in_vehicle( cur_veh, current_submap, processor, signal, active_items );
     }
 }
 
 template<typename T>
 void map::process_items_in_vehicle( vehicle *const cur_veh, submap *const current_submap,
-                                    T processor, std::string const &signal )
+                                    T processor, std::string const &signal,
+                                    std::vector<item_reference> &active_items )
 {
     std::vector<int> cargo_parts = cur_veh->all_parts_with_feature(VPFLAG_CARGO, true);
     for( int part : cargo_parts ) {
         process_vehicle_items( cur_veh, part );
     }
 
-    for( auto &active_item : cur_veh->active_items.get() ) {
+    cur_veh->active_items.get( active_items );
+    for( auto &active_item : active_items ) {
         if ( cargo_parts.empty() ) {
             return;
         } else if( !cur_veh->active_items.has( active_item ) ) {
@@ -3906,9 +4087,9 @@ const field &map::field_at( const tripoint &p ) const
     }
 
     int lx, ly;
-    submap *const current_submap = get_submap_at( p.x, p.y, p.z, lx, ly );
+    const submap *const current_submap = get_submap_at( p.x, p.y, p.z, lx, ly );
 
-    return current_submap->fld[lx][ly];
+    return current_submap->get_field( lx, ly );
 }
 
 /*
@@ -3924,7 +4105,7 @@ field &map::field_at( const tripoint &p )
     int lx, ly;
     submap *const current_submap = get_submap_at( p, lx, ly );
 
-    return current_submap->fld[lx][ly];
+    return current_submap->get_field( lx, ly );
 }
 
 int map::adjust_field_age( const tripoint &p, const field_id t, const int offset ) {
@@ -3992,7 +4173,11 @@ field_entry *map::get_field( const tripoint &p, const field_id t ) {
     int lx, ly;
     submap *const current_submap = get_submap_at( p, lx, ly );
 
-    return current_submap->fld[lx][ly].findField( t );
+    if( static_cast<const submap *>( current_submap )->get_field( lx, ly ).fieldCount() == 0 ) {
+        // Don't add an empty field to the submap just to look at it.
+        return nullptr;
+    }
+    return current_submap->get_field( lx, ly ).findField( t );
 }
 
 bool map::add_field(const tripoint &p, const field_id t, int density, const int age)
@@ -4012,8 +4197,9 @@ bool map::add_field(const tripoint &p, const field_id t, int density, const int
     int lx, ly;
     submap *const current_submap = get_submap_at( p, lx, ly );
     current_submap->is_uniform = false;
+    set_transparency_cache_dirty( p.x / SEEX, p.y / SEEY );
 
-    if( current_submap->fld[lx][ly].addField( t, density, age ) ) {
+    if( current_submap->get_field( lx, ly ).addField( t, density, age ) ) {
         // TODO: Update overall field_count appropriately.
         // This is the spirit of "fd_null" that it used to be.
         current_submap->field_count++; //Only adding it to the count if it doesn't exist.
@@ -4035,11 +4221,13 @@ void map::remove_field( const tripoint &p, const field_id field_to_remove )
     int lx, ly;
     submap * const current_submap = get_submap_at( p, lx, ly );
 
-    if( current_submap->fld[lx][ly].findField( field_to_remove ) ) { //same as checking for fd_null in the old system
+    field &fields = current_submap->get_field( lx, ly );
+    if( fields.findField( field_to_remove ) ) { //same as checking for fd_null in the old system
         current_submap->field_count--;
+        set_transparency_cache_dirty( p.x / SEEX, p.y / SEEY );
     }
 
-    current_submap->fld[lx][ly].removeField(field_to_remove);
+    fields.removeField(field_to_remove);
 }
 
 computer* map::computer_at(const int x, const int y)
@@ -4049,10 +4237,10 @@ computer* map::computer_at(const int x, const int y)
 
  submap * const current_submap = get_submap_at(x, y);
 
- if (current_submap->comp.name == "") {
+ if (!current_submap->comp || current_submap->comp->name == "") {
   return NULL;
  }
- return &(current_submap->comp);
+ return current_submap->comp.get();
 }
 
 bool map::allow_camp(const int x, const int y, const int radius)
@@ -4075,9 +4263,9 @@ basecamp* map::camp_at(const int x, const int y, const int radius)
     for (int ly = sy; ly < ey; ++ly) {
         for (int lx = sx; lx < ex; ++lx) {
             submap * const current_submap = get_submap_at(x, y);
-            if (current_submap->camp.is_valid()) {
+            if (current_submap->camp && current_submap->camp->is_valid()) {
                 // we only allow on camp per size radius, kinda
-                return &(current_submap->camp);
+                return current_submap->camp.get();
             }
         }
     }
@@ -4092,7 +4280,7 @@ void map::add_camp(const std::string& name, const int x, const int y)
         return;
     }
 
-    get_submap_at(x, y)->camp = basecamp(name, x, y);
+    get_submap_at(x, y)->camp.reset( new basecamp(name, x, y) );
 }
 
 void map::debug()
@@ -4224,7 +4412,6 @@ void map::drawsq(WINDOW* w, player &u, const int x, const int y, const bool inve
     const furn_id curr_furn = furn(x,y);
     const trap &curr_trap = tr_at(x, y);
     const field &curr_field = field_at(x, y);
-    auto curr_items = i_at(x, y);
     long sym;
     bool hi = false;
     bool graf = false;
@@ -4302,6 +4489,7 @@ void map::drawsq(WINDOW* w, player &u, const int x, const int y, const bool inve
             hi = true;
         } else {
             // otherwise override with the symbol of the last item
+            auto curr_items = i_at(x, y);
             sym = curr_items[curr_items.size() - 1].symbol();
             if (!draw_item_sym) {
                 tercol = curr_items[curr_items.size() - 1].color();
@@ -4647,22 +4835,22 @@ std::vector<point> map::route(const int Fx, const int Fy, const int Tx, const in
                 }
 
                 int part = -1;
-                const furn_t &furniture = furn_at( x, y );
-                const ter_t &terrain = ter_at( x, y );
                 const vehicle *veh = veh_at_internal( x, y, part );
 
-                const int cost = move_cost_internal( furniture, terrain, veh, part );
-                // Don't calculate bash rating unless we intend to actually use it
-                const int rating = ( bash == 0 || cost != 0 ) ? -1 :
-                                     bash_rating_internal( bash, furniture, terrain, veh, part );
-
-                if( cost == 0 && rating <= 0 && terrain.open.empty() ) {
-                    list[x][y] = ASL_CLOSED; // Close it so that next time we won't try to calc costs
-                    continue;
-                }
-
+                const int cost = move_cost_internal( x, y, veh, part );
                 int newg = gscore[cur.x][cur.y] + cost + ((cur.x - x != 0 && cur.y - y != 0) ? 1 : 0);
                 if( cost == 0 ) {
+                    const furn_t &furniture = furn_at( x, y );
+                    const ter_t &terrain = ter_at( x, y );
+                    // Don't calculate bash rating unless we intend to actually use it
+                    const int rating = bash == 0 ? -1 :
+                                         bash_rating_internal( bash, furniture, terrain, veh, part );
+
+                    if( rating <= 0 && terrain.open.empty() ) {
+                        list[x][y] = ASL_CLOSED; // Close it so that next time we won't try to calc costs
+                        continue;
+                    }
+
                     // Handle all kinds of doors
                     // Only try to open INSIDE doors from the inside
 
@@ -4754,6 +4942,7 @@ void map::save()
 
 void map::load(const int wx, const int wy, const int wz, const bool update_vehicle)
 {
+    turn_profiler::scoped_timer timer( turn_profiler::TP_MAP_LOAD );
     for( auto & traps : traplocs ) {
         traps.clear();
     }
@@ -4784,17 +4973,98 @@ void map::shift_traps( const tripoint &shift )
     }
 }
 
+// Moves the contents of a cache in local coordinates by (dx, dy) tiles: afterwards
+// cache[x][y] is what was at cache[x + dx][y + dy]. Tiles that had no source keep their
+// old (now meaningless) values.
+template<typename T>
+static void shift_cache( T ( &cache )[MAPSIZE * SEEX][MAPSIZE * SEEY], const int dx, const int dy )
+{
+    const int width = MAPSIZE * SEEX;
+    const int height = MAPSIZE * SEEY;
+    if( std::abs( dx ) >= width || std::abs( dy ) >= height ) {
+        return;
+    }
+    const size_t bytes = ( height - std::abs( dy ) ) * sizeof( T );
+    const int dst_y = std::max( -dy, 0 );
+    const int src_y = std::max( dy, 0 );
+    if( dx >= 0 ) {
+        for( int x = 0; x + dx < width; x++ ) {
+            memmove( &cache[x][dst_y], &cache[x + dx][src_y], bytes );
+        }
+    } else {
+        for( int x = width - 1; x + dx >= 0; x-- ) {
+            memmove( &cache[x][dst_y], &cache[x + dx][src_y], bytes );
+        }
+    }
+}
+
+// Same for the per submap dirty flags, submaps that have no source are dirty.
+static void shift_dirty_flags( std::vector<bool> &flags, const int mapsize, const int sx,
+                               const int sy )
+{
+    std::vector<bool> shifted( flags.size(), true );
+    for( int gridx = 0; gridx < mapsize; gridx++ ) {
+        for( int gridy = 0; gridy < mapsize; gridy++ ) {
+            const int fromx = gridx + sx;
+            const int fromy = gridy + sy;
+            if( fromx >= 0 && fromx < mapsize && fromy >= 0 && fromy < mapsize ) {
+                shifted[gridx + gridy * mapsize] = flags[fromx + fromy * mapsize];
+            }
+        }
+    }
+    flags.swap( shifted );
+}
+
+void map::shift_caches( const int sx, const int sy )
+{
+    const int dx = sx * SEEX;
+    const int dy = sy * SEEY;
+    shift_cache( outside_cache, dx, dy );
+    shift_cache( transparency_cache, dx, dy );
+    shift_dirty_flags( outside_submaps_dirty, my_MAPSIZE, sx, sy );
+    shift_dirty_flags( transparency_submaps_dirty, my_MAPSIZE, sx, sy );
+    // The vehicle parts stamped onto the caches have moved with them.
+    const int size_x = SEEX * my_MAPSIZE;
+    const int size_y = SEEY * my_MAPSIZE;
+    for( auto it = vehicle_stamps.begin(); it != vehicle_stamps.end(); ) {
+        it->x -= dx;
+        it->y -= dy;
+        if( it->x >= 0 && it->x < size_x && it->y >= 0 && it->y < size_y ) {
+            ++it;
+        } else {
+            it = vehicle_stamps.erase( it );
+        }
+    }
+
+    std::vector<pathing_tile> shifted_pathing( pathing_cache.size() );
+    for( int x = 0; x < size_x; x++ ) {
+        for( int y = 0; y < size_y; y++ ) {
+            const int fromx = x + dx;
+            const int fromy = y + dy;
+            if( fromx >= 0 && fromx < size_x && fromy >= 0 && fromy < size_y ) {
+                shifted_pathing[x + y * size_x] = pathing_cache[fromx + fromy * size_x];
+            }
+        }
+    }
+    pathing_cache.swap( shifted_pathing );
+    shift_dirty_flags( pathing_cache_dirty, my_MAPSIZE, sx, sy );
+}
+
 void map::shift( const int sx, const int sy )
 {
 // Special case of 0-shift; refresh the map
     if( sx == 0 && sy == 0 ) {
         return; // Skip this?
     }
+    turn_profiler::scoped_timer timer( turn_profiler::TP_MAP_SHIFT );
+    // game::update_map can shift by more than one submap, only the direction is kept.
+    last_shift = point( ( sx > 0 ) - ( sx < 0 ), ( sy > 0 ) - ( sy < 0 ) );
     const int absx = get_abs_sub().x;
     const int absy = get_abs_sub().y;
     const int wz = get_abs_sub().z;
 
     set_abs_sub( absx + sx, absy + sy, wz );
+    shift_caches( sx, sy );
 
 // if player is in vehicle, (s)he must be shifted with vehicle too
     if( g->u.in_vehicle ) {
@@ -4812,6 +5082,19 @@ void map::shift( const int sx, const int sy )
 // Clear vehicle list and rebuild after shift
     clear_vehicle_cache();
     vehicle_list.clear();
+// The submaps that drop out of the map are only kept in the mapbuffer, remove the
+// empty entries that non-const access added to them while they were part of the map.
+    for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+        for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+            if( gridx - sx < 0 || gridx - sx >= my_MAPSIZE ||
+                gridy - sy < 0 || gridy - sy >= my_MAPSIZE ) {
+                submap *leaving = get_submap_at_grid( gridx, gridy );
+                if( leaving != nullptr ) {
+                    leaving->shrink_tile_storage();
+                }
+            }
+        }
+    }
 // Shift the map sx submaps to the right and sy submaps down.
 // sx and sy should never be bigger than +/-1.
 // absx and absy are our position in the world, for saving/loading purposes.
@@ -4942,6 +5225,13 @@ void map::saven( const int gridx, const int gridy, const int gridz )
 // 0,2  1,2  2,2 etc
 // (worldx,worldy,worldz) denotes the absolute coordinate of the submap
 // in grid[0].
+// Each overmap square is two nonants; to prevent overlap, generate only at
+//  squares divisible by 2.
+static point overmap_tile_origin( const int absx, const int absy )
+{
+    return point( absx - ( abs( absx ) % 2 ), absy - ( abs( absy ) % 2 ) );
+}
+
 void map::loadn( const int gridx, const int gridy, const bool update_vehicles ) {
 #ifdef ZLEVELS
     for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
@@ -4977,11 +5267,8 @@ void map::loadn( const int gridx, const int gridy, const int gridz, const bool u
         // It doesn't exist; we must generate it!
         dbg( D_INFO | D_WARNING ) << "map::loadn: Missing mapbuffer data. Regenerating.";
         tinymap tmp_map;
-        // Each overmap square is two nonants; to prevent overlap, generate only at
-        //  squares divisible by 2.
-        const int newmapx = absx - ( abs( absx ) % 2 );
-        const int newmapy = absy - ( abs( absy ) % 2 );
-        tmp_map.generate( newmapx, newmapy, gridz, calendar::turn );
+        const point newmap = overmap_tile_origin( absx, absy );
+        tmp_map.generate( newmap.x, newmap.y, gridz, calendar::turn );
         // This is the same call to MAPBUFFER as above!
         tmpsub = MAPBUFFER.lookup_submap( absx, absy, gridz );
         if( tmpsub == nullptr ) {
@@ -4991,9 +5278,9 @@ void map::loadn( const int gridx, const int gridy, const int gridz, const bool u
         }
     }
 
-    // New submap changes the content of the map and all caches must be recalculated
-    set_transparency_cache_dirty();
-    set_outside_cache_dirty();
+    // New submap changes the content of the map and its part of the caches must be recalculated
+    set_transparency_cache_dirty( gridx, gridy );
+    set_outside_cache_dirty( gridx, gridy );
     setsubmap( gridn, tmpsub );
 
     // Update vehicle data
@@ -5015,6 +5302,71 @@ void map::loadn( const int gridx, const int gridy, const int gridz, const bool u
     abs_sub.z = old_abs_z;
 }
 
+void map::queue_pregeneration( const int dx, const int dy, const int distance )
+{
+    const std::array<int, 6> key = {{ abs_sub.x, abs_sub.y, abs_sub.z, dx, dy, distance }};
+    if( key == pregen_key ) {
+        return;
+    }
+    pregen_key = key;
+    pregen_queue.clear();
+    if( distance <= 0 || ( dx == 0 && dy == 0 ) ) {
+        return;
+    }
+    // All submaps in the band of the given width along the edges of the map the shift vector
+    // points to, ordered by their distance to the map.
+    const int minx = abs_sub.x;
+    const int maxx = abs_sub.x + my_MAPSIZE - 1;
+    const int miny = abs_sub.y;
+    const int maxy = abs_sub.y + my_MAPSIZE - 1;
+    std::vector<std::pair<int, tripoint>> wanted;
+    for( int x = minx + std::min( dx, 0 ) * distance; x <= maxx + std::max( dx, 0 ) * distance; x++ ) {
+        for( int y = miny + std::min( dy, 0 ) * distance; y <= maxy + std::max( dy, 0 ) * distance; y++ ) {
+            const int outside = std::max( std::max( minx - x, x - maxx ), std::max( miny - y, y - maxy ) );
+            if( outside <= 0 ) {
+                continue;
+            }
+            const point origin = overmap_tile_origin( x, y );
+            wanted.emplace_back( outside, tripoint( origin.x, origin.y, abs_sub.z ) );
+        }
+    }
+    std::stable_sort( wanted.begin(), wanted.end(),
+    []( const std::pair<int, tripoint> &a, const std::pair<int, tripoint> &b ) {
+        return a.first < b.first;
+    } );
+    std::set<tripoint, pointcomp> queued;
+    for( auto &elem : wanted ) {
+        if( queued.insert( elem.second ).second ) {
+            pregen_queue.push_back( elem.second );
+        }
+    }
+}
+
+int map::process_pregeneration( const int max_tiles )
+{
+    int generated = 0;
+    while( !pregen_queue.empty() && generated < max_tiles ) {
+        const tripoint origin = pregen_queue.front();
+        pregen_queue.pop_front();
+        // Same condition as in loadn: a tile is generated if any of its submaps is missing.
+        bool missing = false;
+        for( int i = 0; i < 2 && !missing; i++ ) {
+            for( int j = 0; j < 2 && !missing; j++ ) {
+                missing = MAPBUFFER.lookup_submap( origin.x + i, origin.y + j, origin.z ) == nullptr;
+            }
+        }
+        if( !missing ) {
+            continue;
+        }
+        dbg( D_INFO ) << "map::process_pregeneration: generating " << origin.x << "," << origin.y
+                      << "," << origin.z;
+        tinymap tmp_map;
+        tmp_map.generate( origin.x, origin.y, origin.z, calendar::turn );
+        generated++;
+    }
+    return generated;
+}
+
 bool map::has_rotten_away( item &itm, const point &pnt ) const
 {
     if( itm.is_corpse() ) {
@@ -5150,7 +5502,7 @@ void map::actualize( const int gridx, const int gridy, const int gridz )
             const auto &furn = furn_at( pnt.x, pnt.y );
             // plants contain a seed item which must not be removed under any circumstances
             if( !furn.has_flag( "PLANT" ) ) {
-                remove_rotten_items( tmpsub->itm[x][y], pnt );
+                remove_rotten_items( tmpsub->get_items( x, y ), pnt );
             }
 
             const auto trap_here = tmpsub->get_trap( x, y );
@@ -5191,7 +5543,8 @@ void map::copy_grid( const point to, const point from )
     {
 #endif
         const auto smap = get_submap_at_grid( from.x, from.y, z );
-        setsubmap( get_nonant( to.x, to.y, z ), smap );
+        // Not setsubmap, the caches have already been moved along by shift_caches.
+        grid[get_nonant( to.x, to.y, z )] = smap;
         for( auto &it : smap->vehicles ) {
             it->smx = to.x;
             it->smy = to.y;
@@ -5482,32 +5835,65 @@ float map::light_transparency(const int x, const int y) const
   return transparency_cache[x][y];
 }
 
-void map::build_outside_cache()
+// Whether a tile counts as outside: none of the tiles around it (including itself) is indoors.
+bool map::outside_at_tile( const int x, const int y ) const
 {
-    if (!outside_cache_dirty) {
-        return;
+    for( int dx = -1; dx <= 1; dx++ ) {
+        for( int dy = -1; dy <= 1; dy++ ) {
+            if( INBOUNDS( x + dx, y + dy ) && has_flag_ter_or_furn( TFLAG_INDOORS, x + dx, y + dy ) ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool map::build_outside_cache()
+{
+    const bool partly_dirty = std::find( outside_submaps_dirty.begin(), outside_submaps_dirty.end(),
+                                         true ) != outside_submaps_dirty.end();
+    if( !outside_cache_dirty && !partly_dirty ) {
+        return false;
     }
 
     if (g->get_levz() < 0)
     {
         memset(outside_cache, false, sizeof(outside_cache));
-        return;
-    }
-    memset(outside_cache, true, sizeof(outside_cache));
+    } else if( !outside_cache_dirty ) {
+        // Only the dirty submaps and the tiles next to them, which depend on their indoor flags.
+        const int size_x = SEEX * my_MAPSIZE;
+        const int size_y = SEEY * my_MAPSIZE;
+        for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                if( !outside_submaps_dirty[gridx + gridy * my_MAPSIZE] ) {
+                    continue;
+                }
+                const int maxx = std::min( ( gridx + 1 ) * SEEX, size_x - 1 );
+                const int maxy = std::min( ( gridy + 1 ) * SEEY, size_y - 1 );
+                for( int x = std::max( gridx * SEEX - 1, 0 ); x <= maxx; x++ ) {
+                    for( int y = std::max( gridy * SEEY - 1, 0 ); y <= maxy; y++ ) {
+                        outside_cache[x][y] = outside_at_tile( x, y );
+                    }
+                }
+            }
+        }
+    } else {
+        memset(outside_cache, true, sizeof(outside_cache));
 
-    for(int x = 0; x < SEEX * my_MAPSIZE; x++)
-    {
-        for(int y = 0; y < SEEY * my_MAPSIZE; y++)
+        for(int x = 0; x < SEEX * my_MAPSIZE; x++)
         {
-            if( has_flag_ter_or_furn(TFLAG_INDOORS, x, y))
+            for(int y = 0; y < SEEY * my_MAPSIZE; y++)
             {
-                for( int dx = -1; dx <= 1; dx++ )
+                if( has_flag_ter_or_furn(TFLAG_INDOORS, x, y))
                 {
-                    for( int dy = -1; dy <= 1; dy++ )
+                    for( int dx = -1; dx <= 1; dx++ )
                     {
-                        if(INBOUNDS(x + dx, y + dy))
+                        for( int dy = -1; dy <= 1; dy++ )
                         {
-                            outside_cache[x + dx][y + dy] = false;
+                            if(INBOUNDS(x + dx, y + dy))
+                            {
+                                outside_cache[x + dx][y + dy] = false;
+                            }
                         }
                     }
                 }
@@ -5516,36 +5902,76 @@ void map::build_outside_cache()
     }
 
     outside_cache_dirty = false;
+    std::fill( outside_submaps_dirty.begin(), outside_submaps_dirty.end(), false );
+    return true;
 }
 
 void map::build_map_cache()
 {
-    build_outside_cache();
-
-    build_transparency_cache();
-
-    // Cache all the vehicle stuff in one loop
+    // Vehicle parts are stamped onto the outside and transparency caches. That is only redone
+    // when one of the caches was rebuilt, or when the stamps changed (a door was opened, a part
+    // was broken, the vehicle moved, ...), in which case the old stamps are removed by rebuilding
+    // the parts of both caches they are in.
+    new_vehicle_stamps.clear();
     VehicleList vehs = get_vehicles();
     for(auto &v : vehs) {
         for (size_t part = 0; part < v.v->parts.size(); part++) {
             int px = v.x + v.v->parts[part].precalc[0].x;
             int py = v.y + v.v->parts[part].precalc[0].y;
             if(INBOUNDS(px, py)) {
-                if (v.v->is_inside(part)) {
-                    outside_cache[px][py] = false;
-                }
+                const bool inside = v.v->is_inside(part);
+                bool opaque = false;
                 if (v.v->part_flag(part, VPFLAG_OPAQUE) && v.v->parts[part].hp > 0) {
                     int dpart = v.v->part_with_feature(part , VPFLAG_OPENABLE);
-                    if (dpart < 0 || !v.v->parts[dpart].open) {
-                        transparency_cache[px][py] = LIGHT_TRANSPARENCY_SOLID;
-                    }
+                    opaque = dpart < 0 || !v.v->parts[dpart].open;
+                }
+                if( inside || opaque ) {
+                    new_vehicle_stamps.push_back( vehicle_stamp{ px, py, inside, opaque } );
                 }
             }
         }
     }
+    if( new_vehicle_stamps != vehicle_stamps ) {
+        // Rebuilding the submaps of the old and new stamps removes the old ones.
+        for( const auto &stamps : { &vehicle_stamps, &new_vehicle_stamps } ) {
+            for( const auto &stamp : *stamps ) {
+                set_outside_cache_dirty( stamp.x / SEEX, stamp.y / SEEY );
+                set_transparency_cache_dirty( stamp.x / SEEX, stamp.y / SEEY );
+            }
+        }
+        std::swap( new_vehicle_stamps, vehicle_stamps );
+    }
+
+    bool outside_changed = build_outside_cache();
+    bool transparency_changed = build_transparency_cache();
 
-    build_seen_cache();
-    generate_lightmap();
+    if( outside_changed || transparency_changed ) {
+        for( const auto &stamp : vehicle_stamps ) {
+            if( stamp.inside ) {
+                outside_cache[stamp.x][stamp.y] = false;
+            }
+            if( stamp.opaque ) {
+                transparency_cache[stamp.x][stamp.y] = LIGHT_TRANSPARENCY_SOLID;
+            }
+        }
+        // The caches are often rebuilt without any change, e.g. whenever there are fields.
+        outside_changed = memcmp( outside_cache, last_outside_cache, sizeof( outside_cache ) ) != 0;
+        transparency_changed = memcmp( transparency_cache, last_transparency_cache,
+                                       sizeof( transparency_cache ) ) != 0;
+        memcpy( last_outside_cache, outside_cache, sizeof( outside_cache ) );
+        memcpy( last_transparency_cache, transparency_cache, sizeof( transparency_cache ) );
+    }
+
+    // Mirrors and cameras depend on more than what is tracked here, the seen cache is always
+    // rebuilt if the player is in a vehicle.
+    const point player_pos( g->u.posx(), g->u.posy() );
+    int part;
+    if( transparency_changed || seen_cache_origin != player_pos ||
+        veh_at( player_pos.x, player_pos.y, part ) != nullptr ) {
+        build_seen_cache();
+        seen_cache_origin = player_pos;
+    }
+    generate_lightmap( outside_changed || transparency_changed );
 }
 
 std::vector<point> closest_points_first(int radius, point p)
@@ -5600,6 +6026,9 @@ point map::getlocal(const int x, const int y) const {
 
 void map::set_abs_sub(const int x, const int y, const int z)
 {
+    if( z != abs_sub.z ) {
+        set_pathing_cache_dirty();
+    }
     abs_sub = tripoint( x, y, z );
 }
 
@@ -5627,6 +6056,7 @@ void map::setsubmap( const size_t grididx, submap * const smap )
         return;
     }
     grid[grididx] = smap;
+    set_pathing_cache_dirty( grididx );
 }
 
 submap *map::get_submap_at( const int x, const int y, const int z ) const
@@ -5761,12 +6191,11 @@ void map::draw_fill_background(ter_id type) {
     set_outside_cache_dirty();
 
     // Fill each submap rather than each tile
-    constexpr size_t block_size = SEEX * SEEY;
     for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
         for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
             auto sm = get_submap_at_grid( gridx, gridy );
+            sm->fill_ter( type );
             sm->is_uniform = true;
-            std::uninitialized_fill_n( &sm->ter[0][0], block_size, type );
         }
     }
 }
@@ -5845,6 +6274,75 @@ void map::draw_rough_circle_furn(std::string type, int x, int y, int rad) {
     draw_rough_circle(find_furn_id(type), x, y, rad);
 }
 
+// Parses a legend of the form "#:t_wall,.:t_floor" into a symbol -> id table, lookup
+// converts the id strings.
+template<typename Id>
+static void parse_rows_legend( const std::string &legend, Id (&table)[256],
+                               Id (*lookup)( const std::string & ) )
+{
+    size_t pos = 0;
+    while( pos + 1 < legend.size() ) {
+        const size_t end = std::min( legend.find( ',', pos + 2 ), legend.size() );
+        if( legend[pos + 1] == ':' ) {
+            table[static_cast<unsigned char>( legend[pos] )] =
+                lookup( legend.substr( pos + 2, end - pos - 2 ) );
+        } else {
+            debugmsg( "invalid mapgen legend entry %s", legend.substr( pos, end - pos ).c_str() );
+        }
+        pos = end + 1;
+    }
+}
+
+static ter_id rows_ter_id( const std::string &id )
+{
+    return find_ter_id( id );
+}
+
+static furn_id rows_furn_id( const std::string &id )
+{
+    return find_furn_id( id );
+}
+
+void map::draw_rows_ter(int x, int y, std::string rows, std::string legend) {
+    ter_id table[256];
+    std::fill( std::begin( table ), std::end( table ), ter_id( -1 ) );
+    parse_rows_legend( legend, table, rows_ter_id );
+    int cx = x;
+    int cy = y;
+    for( const char c : rows ) {
+        if( c == '\n' ) {
+            cx = x;
+            cy++;
+            continue;
+        }
+        const ter_id id = table[static_cast<unsigned char>( c )];
+        if( id != ter_id( -1 ) ) {
+            ter_set( cx, cy, id );
+        }
+        cx++;
+    }
+}
+
+void map::draw_rows_furn(int x, int y, std::string rows, std::string legend) {
+    furn_id table[256];
+    std::fill( std::begin( table ), std::end( table ), furn_id( -1 ) );
+    parse_rows_legend( legend, table, rows_furn_id );
+    int cx = x;
+    int cy = y;
+    for( const char c : rows ) {
+        if( c == '\n' ) {
+            cx = x;
+            cy++;
+            continue;
+        }
+        const furn_id id = table[static_cast<unsigned char>( c )];
+        if( id != furn_id( -1 ) ) {
+            furn_set( cx, cy, id );
+        }
+        cx++;
+    }
+}
+
 void map::add_corpse(int x, int y) {
     item body;
 
@@ -4,7 +4,10 @@
 #include "cursesdef.h"
 
 #include <stdlib.h>
+#include <cstdint>
 #include <vector>
+#include <deque>
+#include <array>
 #include <string>
 #include <set>
 #include <map>
@@ -43,6 +46,24 @@ struct wrapped_vehicle{
 };
 
 typedef std::vector<wrapped_vehicle> VehicleList;
+
+/** Bits of @ref pathing_tile::flags, each is set if terrain or furniture has the property. */
+enum pathing_flag : uint8_t {
+    PF_BLOCKED = 1 << 0,    // Impassable terrain or furniture, vehicles don't make it passable
+    PF_BASHABLE = 1 << 1,
+    PF_OPENABLE = 1 << 2,   // Terrain is a door (or similar) that can be opened
+    PF_LIQUID = 1 << 3,
+    PF_DEEP_WATER = 1 << 4,
+    PF_SWIMMABLE = 1 << 5,
+    PF_DIGGABLE = 1 << 6,
+    PF_SHARP = 1 << 7
+};
+
+/** What the AI needs to know about the terrain and furniture of a tile, see @ref map::pathing_at. */
+struct pathing_tile {
+    uint8_t cost;   // move_cost without vehicles (saturated at 255), 0 if PF_BLOCKED is set
+    uint8_t flags;  // pathing_flag bits
+};
 typedef std::vector< std::pair< item*, int > > itemslice;
 typedef std::string items_location;
 
@@ -114,6 +135,9 @@ class map
      transparency_cache_dirty = true;
  }
 
+ /** Same as @ref set_transparency_cache_dirty, but only for the submap at gridx, gridy. */
+ void set_transparency_cache_dirty( int gridx, int gridy );
+
  /**
   * Sets a dirty flag on the outside cache.
   *
@@ -125,6 +149,12 @@ class map
      outside_cache_dirty = true;
  }
 
+ /**
+  * Same as @ref set_outside_cache_dirty, but only for the submap at gridx, gridy (and the
+  * adjacent tiles of its neighbours, which depend on it).
+  */
+ void set_outside_cache_dirty( int gridx, int gridy );
+
  /**
   * Callback invoked when a vehicle has moved.
   */
@@ -183,6 +213,27 @@ class map
      * Note: the map must have been loaded before this can be called.
      */
     void shift( const int sx, const int sy );
+    /**
+     * Queues generation of the submaps up to distance submaps beyond the edge of the map in
+     * direction (dx, dy) (each -1, 0 or 1), so later shifts in that direction find them in
+     * the @ref mapbuffer instead of generating them on the spot. Any previously queued
+     * submaps are dropped. Nothing is done if neither the map position nor the arguments
+     * changed since the last call.
+     */
+    void queue_pregeneration( int dx, int dy, int distance );
+    /**
+     * Generates at most max_tiles overmap terrain tiles (2x2 submaps each) of the queue
+     * filled by @ref queue_pregeneration.
+     * @return The number of tiles that were generated.
+     */
+    int process_pregeneration( int max_tiles );
+    /**
+     * Direction of the last call of @ref shift that moved the map. Each component is -1, 0
+     * or 1 even if the map was shifted by several submaps at once.
+     */
+    point get_last_shift() const {
+        return last_shift;
+    }
     /**
      * Moves the map vertically to (not by!) newz.
      * Does not actually shift anything, only forces cache updates.
@@ -233,6 +284,14 @@ class map
  int combined_movecost(const int x1, const int y1, const int x2, const int y2,
                        const vehicle *ignored_vehicle = nullptr, const int modifier = 0) const;
 
+ /**
+  * Packed summary of the terrain and furniture at (x, y) for pathfinding and other AI code,
+  * it is a plain array read in most cases. Vehicles are not included, check @ref veh_at.
+  * (x, y) must be inbounds. The summary is kept for the current z-level and is updated by
+  * @ref ter_set, @ref furn_set and whenever submaps are loaded or shifted.
+  */
+ const pathing_tile &pathing_at(const int x, const int y) const;
+
  /**
   * Returns whether the tile at `(x, y)` is transparent(you can look past it).
   */
@@ -458,6 +517,14 @@ void draw_rough_circle(ter_id type, int x, int y, int rad);
 void draw_rough_circle(std::string type, int x, int y, int rad);
 void draw_rough_circle_furn(furn_id type, int x, int y, int rad);
 void draw_rough_circle_furn(std::string type, int x, int y, int rad);
+/**
+ * Sets the terrain of a block of tiles from rows of symbols, starting at x, y. Rows are separated
+ * by '\n', legend maps the symbols to terrain ids, e.g. "#:t_wall_v,.:t_floor". Tiles whose symbol
+ * is not in the legend are left alone.
+ */
+void draw_rows_ter(int x, int y, std::string rows, std::string legend);
+/** Same as @ref draw_rows_ter, but for furniture. */
+void draw_rows_furn(int x, int y, std::string rows, std::string legend);
 
 void add_corpse(int x, int y);
 
@@ -519,6 +586,14 @@ void add_corpse(int x, int y);
 // Items
  // Accessor that returns a wrapped reference to an item stack for safe modification.
  map_stack i_at(int x, int y);
+ /** Whether there are any items at (x, y), unlike i_at this doesn't add anything to the submap. */
+ bool has_items(const int x, const int y) const;
+ /**
+  * The squares in the rectangle (x1, y1) - (x2, y2) (inclusive, clipped to the map) that
+  * have items on them, ordered by x, then by y. Only the squares that actually hold
+  * items are visited, not the whole rectangle.
+  */
+ std::vector<point> points_with_items(int x1, int y1, int x2, int y2) const;
  item water_from(const int x, const int y);
  item swater_from(const int x, const int y);
  item acid_from(const int x, const int y);
@@ -743,8 +818,18 @@ void add_corpse(int x, int y);
  std::set<vehicle*> vehicle_list;
  std::set<vehicle*> dirty_vehicle_list;
 
- std::map< point, std::pair<vehicle*,int> > veh_cached_parts;
- bool veh_exists_at [SEEX * MAPSIZE][SEEY * MAPSIZE];
+ /**
+  * Vehicle and part number on each tile of the map (index x + y * SEEX * my_MAPSIZE),
+  * the vehicle is nullptr if there is none. If parts of several vehicles are on the same
+  * tile, the first cached one is stored here and the others in @ref veh_overlapping_parts.
+  */
+ std::vector< std::pair<vehicle*,int> > veh_cached_parts;
+ /** Parts of other vehicles on tiles that are already taken in @ref veh_cached_parts. */
+ std::multimap< point, std::pair<vehicle*,int> > veh_overlapping_parts;
+ /** Tiles each cached vehicle has entries on, so they can be cleared without searching the map. */
+ std::unordered_map< const vehicle*, std::vector<point> > veh_cached_tiles;
+ /** Removes the entries of the vehicle from the vehicle cache. */
+ void uncache_vehicle( const vehicle *veh );
 
     /** return @ref abs_sub */
     tripoint get_abs_sub() const;
@@ -831,11 +916,17 @@ protected:
                 const oter_id t_above, const int turn, const float density,
                 const int zlevel, const regional_settings * rsettings);
  void add_extra(map_extra type);
- void build_transparency_cache();
+ /** Rebuilds the dirty parts of the transparency cache, returns whether anything was rebuilt. */
+ bool build_transparency_cache();
 public:
- void build_outside_cache();
+ /** Rebuilds the dirty parts of the outside cache, returns whether anything was rebuilt. */
+ bool build_outside_cache();
 protected:
- void generate_lightmap();
+ /**
+  * Computes @ref lm and @ref sm, unless the light sources are the same as in the last call
+  * and caches_changed is false (the outside and transparency caches are unchanged as well).
+  */
+ void generate_lightmap( bool caches_changed );
  void build_seen_cache();
  void castLight( int row, float start, float end, int xx, int xy, int yx, int yy,
                  const int offsetX, const int offsetY, const int offsetDistance );
@@ -872,6 +963,30 @@ private:
 
  bool transparency_cache_dirty;
  bool outside_cache_dirty;
+ /**
+  * Submaps (index gridx + gridy * my_MAPSIZE) whose part of the transparency / outside cache
+  * must be rebuilt, while the rest of the cache is still valid. Only used if the whole cache
+  * isn't dirty anyway.
+  */
+ std::vector<bool> transparency_submaps_dirty;
+ std::vector<bool> outside_submaps_dirty;
+ /**
+  * Moves the contents of the caches that are kept in local coordinates along with the submaps
+  * when the map is shifted, so only the newly loaded submaps need to be rebuilt.
+  */
+ void shift_caches( int sx, int sy );
+ bool outside_at_tile( int x, int y ) const;
+
+ /** See @ref pathing_at, index x + y * SEEX * my_MAPSIZE. */
+ mutable std::vector<pathing_tile> pathing_cache;
+ /**
+  * One entry per submap of the current z-level (index gridx + gridy * my_MAPSIZE), whether
+  * its part of @ref pathing_cache has to be rebuilt before it can be used.
+  */
+ mutable std::vector<bool> pathing_cache_dirty;
+ void set_pathing_cache_dirty( size_t grididx );
+ void set_pathing_cache_dirty();
+ void update_pathing_tile( const int x, const int y ) const;
 
         /**
          * Get the submap pointer with given index in @ref grid, the index must be valid!
@@ -920,8 +1035,7 @@ private:
      * Internal versions of public functions to avoid checking same variables multiple times.
      * They lack safety checks, because their callers already do those.
      */
-    int move_cost_internal(const furn_t &furniture, const ter_t &terrain, 
-                           const vehicle *veh, const int vpart) const;
+    int move_cost_internal(const int x, const int y, const vehicle *veh, const int vpart) const;
     int bash_rating_internal( const int str, const furn_t &furniture, 
                               const ter_t &terrain, const vehicle *veh, const int part ) const;
 
@@ -937,20 +1051,82 @@ private:
                       int sx, int sy, int ex, int ey, float luminance, bool trig_brightcalc = true);
  void add_light_from_items( const int x, const int y, std::list<item>::iterator begin,
                             std::list<item>::iterator end );
+
+ /** A light source found by @ref generate_lightmap, see there. */
+ struct light_op {
+     enum op_type : char {
+         SET_LIGHT,    // assign luminance to lm
+         ADD_SOURCE,   // add_light_source
+         APPLY_SOURCE, // apply_light_source
+         APPLY_ARC,    // apply_light_arc
+         NIGHT_VISION  // darken the area around (x, y) after everything else
+     };
+     op_type type;
+     int x;
+     int y;
+     float luminance;
+     bool trig_brightcalc;
+     int angle;
+     int wideangle;
+
+     bool operator==( const light_op &rhs ) const {
+         return type == rhs.type && x == rhs.x && y == rhs.y && luminance == rhs.luminance &&
+                trig_brightcalc == rhs.trig_brightcalc && angle == rhs.angle &&
+                wideangle == rhs.wideangle;
+     }
+ };
+ void queue_light( light_op::op_type type, int x, int y, float luminance,
+                   bool trig_brightcalc = false, int angle = 0, int wideangle = 30 );
+ // The light sources of the current call of generate_lightmap, and those lm and sm were
+ // computed from.
+ std::vector<light_op> light_ops;
+ std::vector<light_op> applied_light_ops;
+
+ /**
+  * Origins (absolute submap coordinates, as used by @ref loadn) of the overmap terrain tiles
+  * waiting to be generated, nearest to the map first. pregen_key is the map position and
+  * arguments of the @ref queue_pregeneration call that filled it.
+  */
+ std::deque<tripoint> pregen_queue;
+ std::array<int, 6> pregen_key;
+ point last_shift;
+
+ /** A tile of the outside and transparency caches that is overridden by a vehicle part. */
+ struct vehicle_stamp {
+     int x;
+     int y;
+     bool inside;
+     bool opaque;
+
+     bool operator==( const vehicle_stamp &rhs ) const {
+         return x == rhs.x && y == rhs.y && inside == rhs.inside && opaque == rhs.opaque;
+     }
+ };
+ // The vehicle stamps currently applied to the caches, see build_map_cache.
+ std::vector<vehicle_stamp> vehicle_stamps;
+ std::vector<vehicle_stamp> new_vehicle_stamps;
+ // Where the player was when the seen cache was built, (-1, -1) if it has to be rebuilt.
+ point seen_cache_origin;
  void calc_ray_end(int angle, int range, int x, int y, int* outx, int* outy) const;
  vehicle *add_vehicle_to_map(vehicle *veh, bool merge_wrecks);
 
  // Iterates over every item on the map, passing each item to the provided function.
  template<typename T>
      void process_items( bool active, T processor, std::string const &signal );
+ // The active_items vector is only a buffer for the items to process, its content is replaced.
  template<typename T>
      void process_items_in_submap( submap * current_submap, int gridx, int gridy,
-                                   T processor, std::string const &signal );
+                                   T processor, std::string const &signal,
+                                   std::vector<item_reference> &active_items );
  template<typename T>
-     void process_items_in_vehicles( submap *current_submap, T processor, std::string const &signal);
+     void process_items_in_vehicles( submap *current_submap, T processor, std::string const &signal,
+                                     std::vector<item_reference> &active_items );
  template<typename T>
      void process_items_in_vehicle( vehicle *cur_veh, submap *current_submap,
-                                    T processor, std::string const &signal );
+                                    T processor, std::string const &signal,
+                                    std::vector<item_reference> &active_items );
+ // Kept between calls of process_items so processing active items does not allocate each turn.
+ std::vector<item_reference> active_item_buffer;
 
  float lm[MAPSIZE*SEEX][MAPSIZE*SEEY];
  float sm[MAPSIZE*SEEX][MAPSIZE*SEEY];
@@ -959,6 +1135,9 @@ private:
  float light_source_buffer[MAPSIZE*SEEX][MAPSIZE*SEEY];
  bool outside_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
  float transparency_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
+ // The outside and transparency caches the seen cache and lightmap were computed from.
+ bool last_outside_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
+ float last_transparency_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
  bool seen_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
         /**
          * The list of currently loaded submaps. The size of this should not be changed.
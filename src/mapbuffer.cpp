@@ -197,6 +197,7 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
     }
 
     JsonOut jsout( fout );
+    jsout.reserve_buffer();
     jsout.start_array();
     for( auto &submap_addr : submap_addrs ) {
         if( submaps.count( submap_addr ) == 0 ) {
@@ -207,6 +208,10 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         if( sm == nullptr ) {
             continue;
         }
+        // Drop the empty entries that were added by looking at squares without items etc.
+        sm->shrink_tile_storage();
+        // Read through this, the non-const accessors would add the entries back.
+        const submap &saved_sm = *sm;
 
         jsout.start_object();
 
@@ -222,12 +227,32 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         jsout.member( "turn_last_touched", sm->turn_last_touched );
         jsout.member( "temperature", sm->temperature );
 
+        // The terrain is saved as indices into a table of the terrain ids used in this
+        // submap, so each id string is only written (and looked up when loading) once.
+        std::vector<int> ter_index( terlist.size(), -1 );
+        std::vector<ter_id> ter_table;
+        for(int j = 0; j < SEEY; j++) {
+            for(int i = 0; i < SEEX; i++) {
+                const ter_id t = sm->get_ter( i, j );
+                if( ter_index[t] < 0 ) {
+                    ter_index[t] = ter_table.size();
+                    ter_table.push_back( t );
+                }
+            }
+        }
+        jsout.member( "terrain_ids" );
+        jsout.start_array();
+        for( const ter_id t : ter_table ) {
+            jsout.write( terlist[t].id );
+        }
+        jsout.end_array();
+
         jsout.member( "terrain" );
         jsout.start_array();
         for(int j = 0; j < SEEY; j++) {
             for(int i = 0; i < SEEX; i++) {
                 // Save terrains
-                jsout.write( terlist[sm->ter[i][j]].id );
+                jsout.write( ter_index[sm->get_ter( i, j )] );
             }
         }
         jsout.end_array();
@@ -257,6 +282,25 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         jsout.write( count );
         jsout.end_array();
 
+        // Same kind of table as for the terrain.
+        std::vector<int> furn_index( furnlist.size(), -1 );
+        std::vector<furn_id> furn_table;
+        for(int j = 0; j < SEEY; j++) {
+            for(int i = 0; i < SEEX; i++) {
+                const furn_id f = sm->get_furn( i, j );
+                if( f != f_null && furn_index[f] < 0 ) {
+                    furn_index[f] = furn_table.size();
+                    furn_table.push_back( f );
+                }
+            }
+        }
+        jsout.member( "furniture_ids" );
+        jsout.start_array();
+        for( const furn_id f : furn_table ) {
+            jsout.write( furnlist[f].id );
+        }
+        jsout.end_array();
+
         jsout.member("furniture");
         jsout.start_array();
         for(int j = 0; j < SEEY; j++) {
@@ -266,7 +310,7 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
                     jsout.start_array();
                     jsout.write( i );
                     jsout.write( j );
-                    jsout.write( furnlist[ sm->get_furn( i, j ) ].id );
+                    jsout.write( furn_index[ sm->get_furn( i, j ) ] );
                     jsout.end_array();
                 }
             }
@@ -277,12 +321,13 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         jsout.start_array();
         for(int j = 0; j < SEEY; j++) {
             for(int i = 0; i < SEEX; i++) {
-                if( sm->itm[i][j].empty() ) {
+                const auto &items = saved_sm.get_items( i, j );
+                if( items.empty() ) {
                     continue;
                 }
                 jsout.write( i );
                 jsout.write( j );
-                jsout.write( sm->itm[i][j] );
+                jsout.write( items );
             }
         }
         jsout.end_array();
@@ -308,11 +353,12 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         for(int j = 0; j < SEEY; j++) {
             for(int i = 0; i < SEEX; i++) {
                 // Save fields
-                if (sm->fld[i][j].fieldCount() > 0) {
+                const field &fields = saved_sm.get_field( i, j );
+                if (fields.fieldCount() > 0) {
                     jsout.write( i );
                     jsout.write( j );
                     jsout.start_array();
-                    for( auto &fld : sm->fld[i][j] ) {
+                    for( auto &fld : fields ) {
                         const field_entry &cur = fld.second;
                             // We don't seem to have a string identifier for fields anywhere.
                             jsout.write( cur.getFieldType() );
@@ -329,11 +375,12 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         jsout.start_array();
         for (int j = 0; j < SEEY; j++) {
             for (int i = 0; i < SEEX; i++) {
-                if (sm->cosmetics[i][j].size() > 0) {
+                const auto &cosmetics = saved_sm.get_cosmetics( i, j );
+                if (cosmetics.size() > 0) {
                     jsout.start_array();
                     jsout.write(i);
                     jsout.write(j);
-                    jsout.write(sm->cosmetics[i][j]);
+                    jsout.write(cosmetics);
                     jsout.end_array();
                 }
             }
@@ -367,14 +414,14 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         jsout.end_array();
 
         // Output the computer
-        if (sm->comp.name != "") {
-            jsout.member( "computers", sm->comp.save_data() );
+        if (sm->comp && sm->comp->name != "") {
+            jsout.member( "computers", sm->comp->save_data() );
         }
 
         // Output base camp if any
-        if (sm->camp.is_valid()) {
+        if (sm->camp && sm->camp->is_valid()) {
             jsout.member( "camp" );
-            jsout.write( sm->camp.save_data() );
+            jsout.write( sm->camp->save_data() );
         }
         if( delete_after_save ) {
             submaps_to_delete.push_back( submap_addr );
@@ -411,6 +458,10 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
         tripoint submap_coordinates;
         jsin.start_object();
         bool rubpow_update = false;
+        // Tables of the terrain / furniture ids used in the submap. Older saves have no
+        // tables and store the id strings directly.
+        std::vector<ter_id> ter_table;
+        std::vector<furn_id> furn_table;
         while( !jsin.end_object() ) {
             std::string submap_member_name = jsin.get_member_name();
             if( submap_member_name == "version" ) {
@@ -428,6 +479,16 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
                 sm->turn_last_touched = jsin.get_int();
             } else if( submap_member_name == "temperature" ) {
                 sm->temperature = jsin.get_int();
+            } else if( submap_member_name == "terrain_ids" ) {
+                jsin.start_array();
+                while( !jsin.end_array() ) {
+                    ter_table.push_back( termap[ jsin.get_string() ].loadid );
+                }
+            } else if( submap_member_name == "furniture_ids" ) {
+                jsin.start_array();
+                while( !jsin.end_array() ) {
+                    furn_table.push_back( furnmap[ jsin.get_string() ].loadid );
+                }
             } else if( submap_member_name == "terrain" ) {
                 // TODO: try block around this to error out if we come up short?
                 jsin.start_array();
@@ -440,33 +501,39 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
                         for( int i = 0; i < SEEX; i++ ) {
                             ter_string = jsin.get_string();
                             if (ter_string == "t_rubble") {
-                                sm->ter[i][j] = termap[ "t_dirt" ].loadid;
-                                sm->frn[i][j] = furnmap[ "f_rubble" ].loadid;
-                                sm->itm[i][j].push_back( rock );
-                                sm->itm[i][j].push_back( rock );
+                                sm->set_ter( i, j, termap[ "t_dirt" ].loadid );
+                                sm->set_furn( i, j, furnmap[ "f_rubble" ].loadid );
+                                sm->get_items( i, j ).push_back( rock );
+                                sm->get_items( i, j ).push_back( rock );
                             } else if (ter_string == "t_wreckage"){
-                                sm->ter[i][j] = termap[ "t_dirt" ].loadid;
-                                sm->frn[i][j] = furnmap[ "f_wreckage" ].loadid;
-                                sm->itm[i][j].push_back( chunk );
-                                sm->itm[i][j].push_back( chunk );
+                                sm->set_ter( i, j, termap[ "t_dirt" ].loadid );
+                                sm->set_furn( i, j, furnmap[ "f_wreckage" ].loadid );
+                                sm->get_items( i, j ).push_back( chunk );
+                                sm->get_items( i, j ).push_back( chunk );
                             } else if (ter_string == "t_ash"){
-                                sm->ter[i][j] = termap[ "t_dirt" ].loadid;
-                                sm->frn[i][j] = furnmap[ "f_ash" ].loadid;
+                                sm->set_ter( i, j, termap[ "t_dirt" ].loadid );
+                                sm->set_furn( i, j, furnmap[ "f_ash" ].loadid );
                             } else if (ter_string == "t_pwr_sb_support_l"){
-                                sm->ter[i][j] = termap[ "t_support_l" ].loadid;
+                                sm->set_ter( i, j, termap[ "t_support_l" ].loadid );
                             } else if (ter_string == "t_pwr_sb_switchgear_l"){
-                                sm->ter[i][j] = termap[ "t_switchgear_l" ].loadid;
+                                sm->set_ter( i, j, termap[ "t_switchgear_l" ].loadid );
                             } else if (ter_string == "t_pwr_sb_switchgear_s"){
-                                sm->ter[i][j] = termap[ "t_switchgear_s" ].loadid;
+                                sm->set_ter( i, j, termap[ "t_switchgear_s" ].loadid );
                             } else {
-                                sm->ter[i][j] = termap[ ter_string ].loadid;
+                                sm->set_ter( i, j, termap[ ter_string ].loadid );
                             }
                         }
                     }
+                } else if( !ter_table.empty() ) {
+                    for( int j = 0; j < SEEY; j++ ) {
+                        for( int i = 0; i < SEEX; i++ ) {
+                            sm->set_ter( i, j, ter_table.at( jsin.get_int() ) );
+                        }
+                    }
                 } else {
                     for( int j = 0; j < SEEY; j++ ) {
                         for( int i = 0; i < SEEX; i++ ) {
-                            sm->ter[i][j] = termap[ jsin.get_string() ].loadid;
+                            sm->set_ter( i, j, termap[ jsin.get_string() ].loadid );
                         }
                     }
                 }
@@ -490,7 +557,11 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
                     jsin.start_array();
                     int i = jsin.get_int();
                     int j = jsin.get_int();
-                    sm->frn[i][j] = furnmap[ jsin.get_string() ].loadid;
+                    if( !furn_table.empty() ) {
+                        sm->set_furn( i, j, furn_table.at( jsin.get_int() ) );
+                    } else {
+                        sm->set_furn( i, j, furnmap[ jsin.get_string() ].loadid );
+                    }
                     jsin.end_array();
                 }
             } else if( submap_member_name == "items" ) {
@@ -506,9 +577,9 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
                             sm->update_lum_add(tmp, i, j);
                         }
 
-                        sm->itm[i][j].push_back( tmp );
+                        sm->get_items( i, j ).push_back( tmp );
                         if( tmp.needs_processing() ) {
-                            sm->active_items.add( std::prev(sm->itm[i][j].end()), point( i, j ) );
+                            sm->active_items.add( std::prev(sm->get_items( i, j ).end()), point( i, j ) );
                         }
                     }
                 }
@@ -518,7 +589,7 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
                     jsin.start_array();
                     int i = jsin.get_int();
                     int j = jsin.get_int();
-                    sm->trp[i][j] = trapmap[ jsin.get_string() ];
+                    sm->set_trap( i, j, trapmap[ jsin.get_string() ] );
                     jsin.end_array();
                 }
             } else if( submap_member_name == "fields" ) {
@@ -532,10 +603,10 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
                         int type = jsin.get_int();
                         int density = jsin.get_int();
                         int age = jsin.get_int();
-                        if (sm->fld[i][j].findField(field_id(type)) == NULL) {
+                        if (sm->get_field( i, j ).findField(field_id(type)) == NULL) {
                             sm->field_count++;
                         }
-                        sm->fld[i][j].addField(field_id(type), density, age);
+                        sm->get_field( i, j ).addField(field_id(type), density, age);
                     }
                 }
             } else if( submap_member_name == "graffiti" ) {
@@ -553,7 +624,7 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
                     jsin.start_array();
                     int i = jsin.get_int();
                     int j = jsin.get_int();
-                    jsin.read(sm->cosmetics[i][j]);
+                    jsin.read(sm->get_cosmetics( i, j ));
                     jsin.end_array();
                 }
             } else if( submap_member_name == "spawns" ) {
@@ -581,10 +652,12 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
                 }
             } else if( submap_member_name == "computers" ) {
                 std::string computer_data = jsin.get_string();
-                sm->comp.load_data( computer_data );
+                sm->comp.reset( new computer() );
+                sm->comp->load_data( computer_data );
             } else if( submap_member_name == "camp" ) {
                 std::string camp_data = jsin.get_string();
-                sm->camp.load_data( camp_data );
+                sm->camp.reset( new basecamp() );
+                sm->camp->load_data( camp_data );
             } else {
                 jsin.skip_value();
             }
@@ -4,7 +4,9 @@
 #include "game_constants.h"
 #include "debug.h"
 #include <ostream>
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 
 std::vector<ter_t> terlist;
 std::map<std::string, ter_t> termap;
@@ -14,6 +16,26 @@ std::map<std::string, furn_t> furnmap;
 
 std::map<std::string, ter_bitflags> ter_bitflags_map;
 
+// Ids are never removed, so they stay valid when the data is reloaded for another world.
+static std::unordered_map<std::string, int> map_flag_ids;
+
+int map_flag_id( const std::string &flag )
+{
+    const auto iter = map_flag_ids.find( flag );
+    return iter == map_flag_ids.end() ? -1 : iter->second;
+}
+
+int intern_map_flag( const std::string &flag )
+{
+    const auto iter = map_flag_ids.find( flag );
+    if( iter != map_flag_ids.end() ) {
+        return iter->second;
+    }
+    const int id = map_flag_ids.size();
+    map_flag_ids[flag] = id;
+    return id;
+}
+
 std::ostream & operator<<(std::ostream & out, const submap * sm)
 {
  out << "submap(";
@@ -28,7 +50,7 @@ std::ostream & operator<<(std::ostream & out, const submap * sm)
  {
   out << "\n\t" << x << ": ";
   for(int y = 0; y < SEEY; ++y)
-   out << sm->ter[x][y] << ", ";
+   out << sm->get_ter(x, y) << ", ";
  }
 
  out << "\n\titm:";
@@ -36,9 +58,10 @@ std::ostream & operator<<(std::ostream & out, const submap * sm)
  {
   for(int y = 0; y < SEEY; ++y)
   {
-   if( !sm->itm[x][y].empty() )
+   const auto &items = static_cast<const submap *>( sm )->get_items( x, y );
+   if( !items.empty() )
    {
-    for( auto it = sm->itm[x][y].begin(), end = sm->itm[x][y].end(); it != end; ++it )
+    for( auto it = items.begin(), end = items.end(); it != end; ++it )
     {
      out << "\n\t("<<x<<","<<y<<") ";
      out << *it << ", ";
@@ -902,24 +925,121 @@ void check_furniture_and_terrain()
     }
 }
 
-submap::submap()
+submap_tiles::submap_tiles( const ter_id terrain )
 {
     constexpr size_t elements = SEEX * SEEY;
 
-    std::uninitialized_fill_n(&ter[0][0], elements, t_null);
+    std::uninitialized_fill_n(&ter[0][0], elements, terrain);
     std::uninitialized_fill_n(&frn[0][0], elements, f_null);
     std::uninitialized_fill_n(&lum[0][0], elements, 0);
     std::uninitialized_fill_n(&trp[0][0], elements, tr_null);
     std::uninitialized_fill_n(&rad[0][0], elements, 0);
+}
+
+bool submap_tiles::only_terrain() const
+{
+    constexpr size_t elements = SEEX * SEEY;
+
+    return std::all_of( &frn[0][0], &frn[0][0] + elements, []( furn_id f ) { return f == f_null; } ) &&
+           std::all_of( &lum[0][0], &lum[0][0] + elements, []( std::uint8_t l ) { return l == 0; } ) &&
+           std::all_of( &trp[0][0], &trp[0][0] + elements, []( trap_id t ) { return t == tr_null; } ) &&
+           std::all_of( &rad[0][0], &rad[0][0] + elements, []( int r ) { return r == 0; } );
+}
 
+// One instance per terrain, shared by all submaps that consist of only that terrain.
+// They are never freed, there are only as many as there are terrain types.
+static const std::shared_ptr<submap_tiles> &uniform_tiles( const ter_id terrain )
+{
+    static std::unordered_map<ter_id, std::shared_ptr<submap_tiles>> shared_tiles;
+    auto &result = shared_tiles[terrain];
+    if( !result ) {
+        result = std::make_shared<submap_tiles>( terrain );
+    }
+    return result;
+}
+
+submap::submap() : tiles( uniform_tiles( t_null ) )
+{
     is_uniform = false;
 }
 
+void submap::fill_ter( const ter_id terr )
+{
+    if( tiles->only_terrain() ) {
+        tiles = uniform_tiles( terr );
+        return;
+    }
+    constexpr size_t elements = SEEX * SEEY;
+    auto &own = mutable_tiles();
+    std::fill_n( &own.ter[0][0], elements, terr );
+}
+
 submap::~submap()
 {
     delete_vehicles();
 }
 
+std::list<item> &submap::get_items( const int x, const int y )
+{
+    return tile_items[x + y * SEEX];
+}
+
+const std::list<item> &submap::get_items( const int x, const int y ) const
+{
+    static const std::list<item> no_items;
+    const auto iter = tile_items.find( x + y * SEEX );
+    return iter == tile_items.end() ? no_items : iter->second;
+}
+
+field &submap::get_field( const int x, const int y )
+{
+    return tile_fields[x + y * SEEX];
+}
+
+const field &submap::get_field( const int x, const int y ) const
+{
+    static const field no_field;
+    const auto iter = tile_fields.find( x + y * SEEX );
+    return iter == tile_fields.end() ? no_field : iter->second;
+}
+
+std::map<std::string, std::string> &submap::get_cosmetics( const int x, const int y )
+{
+    return tile_cosmetics[x + y * SEEX];
+}
+
+const std::map<std::string, std::string> &submap::get_cosmetics( const int x, const int y ) const
+{
+    static const std::map<std::string, std::string> no_cosmetics;
+    const auto iter = tile_cosmetics.find( x + y * SEEX );
+    return iter == tile_cosmetics.end() ? no_cosmetics : iter->second;
+}
+
+template<typename Container, typename IsEmpty>
+static void remove_empty_entries( Container &entries, IsEmpty is_empty )
+{
+    for( auto iter = entries.begin(); iter != entries.end(); ) {
+        if( is_empty( iter->second ) ) {
+            iter = entries.erase( iter );
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void submap::shrink_tile_storage()
+{
+    remove_empty_entries( tile_items, []( const std::list<item> &items ) {
+        return items.empty();
+    } );
+    remove_empty_entries( tile_fields, []( const field &fld ) {
+        return fld.fieldCount() == 0;
+    } );
+    remove_empty_entries( tile_cosmetics, []( const std::map<std::string, std::string> &cosmetics ) {
+        return cosmetics.empty();
+    } );
+}
+
 void submap::delete_vehicles()
 {
     for(vehicle *veh : vehicles) {
@@ -932,13 +1052,14 @@ static const std::string COSMETICS_GRAFFITI( "GRAFFITI" );
 
 bool submap::has_graffiti( int x, int y ) const
 {
-    return cosmetics[x][y].count( COSMETICS_GRAFFITI ) > 0;
+    return get_cosmetics( x, y ).count( COSMETICS_GRAFFITI ) > 0;
 }
 
 const std::string &submap::get_graffiti( int x, int y ) const
 {
-    const auto it = cosmetics[x][y].find( COSMETICS_GRAFFITI );
-    if( it == cosmetics[x][y].end() ) {
+    const auto &cosmetics = get_cosmetics( x, y );
+    const auto it = cosmetics.find( COSMETICS_GRAFFITI );
+    if( it == cosmetics.end() ) {
         static const std::string empty_string;
         return empty_string;
     }
@@ -948,11 +1069,11 @@ const std::string &submap::get_graffiti( int x, int y ) const
 void submap::set_graffiti( int x, int y, const std::string &new_graffiti )
 {
     is_uniform = false;
-    cosmetics[x][y][COSMETICS_GRAFFITI] = new_graffiti;
+    get_cosmetics( x, y )[COSMETICS_GRAFFITI] = new_graffiti;
 }
 
 void submap::delete_graffiti( int x, int y )
 {
     is_uniform = false;
-    cosmetics[x][y].erase( COSMETICS_GRAFFITI );
+    get_cosmetics( x, y ).erase( COSMETICS_GRAFFITI );
 }
@@ -16,6 +16,8 @@
 #include "rng.h"
 
 #include <iosfwd>
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <list>
@@ -168,6 +170,16 @@ enum ter_bitflags {
 extern std::map<std::string, ter_bitflags> ter_bitflags_map;
 void init_ter_bitflags_map();
 
+/*
+ * Every flag string of every terrain and furniture type is interned into a small integer id
+ * when the type is loaded, the flags of a type are stored as a bitset indexed by those ids.
+ * This covers all flags, including those only used by mods, unlike ter_bitflags.
+ */
+/** Id of the flag, -1 if no terrain or furniture has been loaded with this flag. */
+int map_flag_id( const std::string &flag );
+/** Like @ref map_flag_id, but assigns a new id to flags that haven't been seen before. */
+int intern_map_flag( const std::string &flag );
+
 typedef int ter_id;
 typedef int furn_id;
 
@@ -180,7 +192,7 @@ struct map_data_common_t {
     map_bash_info        bash;
     map_deconstruct_info deconstruct;
 
-    std::set<std::string> flags;    // string flags which possibly refer to what's documented above.
+    std::vector<bool>     flags;    // string flags which possibly refer to what's documented above, indexed by map_flag_id
     unsigned long         bitflags; // bitfield of -certian- string flags which are heavily checked
 
     /*
@@ -201,7 +213,12 @@ struct map_data_common_t {
     bool transparent;
 
     bool has_flag(const std::string & flag) const {
-        return !!flags.count(flag);
+        return has_flag_id( map_flag_id( flag ) );
+    }
+
+    /** flag_id as returned by @ref map_flag_id, -1 is allowed and never set. */
+    bool has_flag_id(const int flag_id) const {
+        return flag_id >= 0 && flag_id < (int)flags.size() && flags[flag_id];
     }
 
     bool has_flag(const ter_bitflags flag) const {
@@ -209,7 +226,11 @@ struct map_data_common_t {
     }
 
     void set_flag(std::string flag) {
-        flags.insert( flag );
+        const int flag_id = intern_map_flag( flag );
+        if( flag_id >= (int)flags.size() ) {
+            flags.resize( flag_id + 1, false );
+        }
+        flags[flag_id] = true;
 
         if(!transparent && "TRANSPARENT" == flag) {
             transparent = true;
@@ -332,47 +353,80 @@ struct spawn_point {
              mission_id (MIS), friendly (F), name (N) {}
 };
 
+/**
+ * The dense per-square layers of a @ref submap. Submaps that are a solid block of a
+ * single terrain (and fresh submaps) share one instance per terrain, a submap gets its
+ * own copy the first time it changes any of the layers.
+ */
+struct submap_tiles {
+    ter_id          ter[SEEX][SEEY];  // Terrain on each square
+    furn_id         frn[SEEX][SEEY];  // Furniture on each square
+    std::uint8_t    lum[SEEX][SEEY];  // Number of items emitting light on each square
+    trap_id         trp[SEEX][SEEY];  // Trap on each square
+    int             rad[SEEX][SEEY];  // Irradiation of each square
+
+    /** All squares have the given terrain and nothing else. */
+    submap_tiles( ter_id terrain );
+    /** Whether nothing but terrain is set on any square. */
+    bool only_terrain() const;
+};
+
 struct submap {
     inline trap_id get_trap( const int x, const int y ) const {
-        return trp[x][y];
+        return tiles->trp[x][y];
     }
 
     inline void set_trap( const int x, const int y, trap_id trap ) {
         is_uniform = false;
-        trp[x][y] = trap;
+        mutable_tiles().trp[x][y] = trap;
     }
 
     inline furn_id get_furn( const int x, const int y ) const {
-        return frn[x][y];
+        return tiles->frn[x][y];
     }
 
     inline void set_furn( const int x, const int y, furn_id furn ) {
         is_uniform = false;
-        frn[x][y] = furn;
+        mutable_tiles().frn[x][y] = furn;
     }
 
     inline ter_id get_ter( const int x, const int y ) const {
-        return ter[x][y];
+        return tiles->ter[x][y];
     }
 
     inline void set_ter( const int x, const int y, ter_id terr ) {
         is_uniform = false;
-        ter[x][y] = terr;
+        mutable_tiles().ter[x][y] = terr;
     }
 
+    /**
+     * Makes every square the given terrain. If nothing but terrain has been placed
+     * on the submap, the squares are shared with all other submaps of that terrain.
+     */
+    void fill_ter( ter_id terr );
+
     inline int get_radiation( const int x, const int y ) const {
-        return rad[x][y];
+        return tiles->rad[x][y];
     }
 
     void set_radiation( const int x, const int y, const int radiation ) {
         is_uniform = false;
-        rad[x][y] = radiation;
+        mutable_tiles().rad[x][y] = radiation;
+    }
+
+    inline std::uint8_t get_lum( const int x, const int y ) const {
+        return tiles->lum[x][y];
+    }
+
+    void set_lum( const int x, const int y, const std::uint8_t count ) {
+        is_uniform = false;
+        mutable_tiles().lum[x][y] = count;
     }
 
     void update_lum_add( item const &i, int const x, int const y ) {
         is_uniform = false;
-        if (i.is_emissive() && lum[x][y] < 255) {
-            lum[x][y]++;
+        if (i.is_emissive() && tiles->lum[x][y] < 255) {
+            mutable_tiles().lum[x][y]++;
         }
     }
 
@@ -380,22 +434,22 @@ struct submap {
         is_uniform = false;
         if (!i.is_emissive()) {
             return;
-        } else if (lum[x][y] && lum[x][y] < 255) {
-            lum[x][y]--;
+        } else if (tiles->lum[x][y] && tiles->lum[x][y] < 255) {
+            mutable_tiles().lum[x][y]--;
             return;
         }
 
         // Have to scan through all items to be sure removing i will actally lower
         // the count below 255.
         int count = 0;
-        for (auto const &it : itm[x][y]) {
+        for (auto const &it : get_items(x, y)) {
             if (it.is_emissive()) {
                 count++;
             }
         }
 
         if (count <= 256) {
-            lum[x][y] = static_cast<uint8_t>(count - 1);
+            mutable_tiles().lum[x][y] = static_cast<uint8_t>(count - 1);
         }
     }
 
@@ -408,19 +462,20 @@ struct submap {
     // writing on the square. When both are present, we have signage.
     // Its effect is meant to be cosmetic and atmospheric only.
     inline bool has_signage( const int x, const int y) const {
-        furn_id f = frn[x][y];
+        furn_id f = tiles->frn[x][y];
         if( furnlist[f].id == "f_sign" ) {
-            return cosmetics[x][y].find("SIGNAGE") != cosmetics[x][y].end();
+            return get_cosmetics(x, y).count("SIGNAGE") > 0;
         }
 
         return false;
     }
     // Dependent on furniture + cosmetics.
     inline const std::string get_signage( const int x, const int y ) const {
-        furn_id f = frn[x][y];
+        furn_id f = tiles->frn[x][y];
         if( furnlist[f].id == "f_sign" ) {
-            auto iter = cosmetics[x][y].find("SIGNAGE");
-            if( iter != cosmetics[x][y].end() ) {
+            const auto &cosmetics = get_cosmetics(x, y);
+            auto iter = cosmetics.find("SIGNAGE");
+            if( iter != cosmetics.end() ) {
                 return iter->second;
             }
         }
@@ -430,28 +485,57 @@ struct submap {
     // Can be used anytime (prevents code from needing to place sign first.)
     inline void set_signage( const int x, const int y, std::string s) {
         is_uniform = false;
-        cosmetics[x][y]["SIGNAGE"] = s;
+        get_cosmetics(x, y)["SIGNAGE"] = s;
     }
     // Can be used anytime (prevents code from needing to place sign first.)
     inline void delete_signage( const int x, const int y) {
         is_uniform = false;
-        cosmetics[x][y].erase("SIGNAGE");
+        get_cosmetics(x, y).erase("SIGNAGE");
     }
 
-    // TODO: make trp private once the horrible hack known as editmap is resolved
-    ter_id          ter[SEEX][SEEY];  // Terrain on each square
-    furn_id         frn[SEEX][SEEY];  // Furniture on each square
-    std::uint8_t    lum[SEEX][SEEY];  // Number of items emitting light on each square
-    std::list<item> itm[SEEX][SEEY];  // Items on each square
-    field           fld[SEEX][SEEY];  // Field on each square
-    trap_id         trp[SEEX][SEEY];  // Trap on each square
-    int             rad[SEEX][SEEY];  // Irradiation of each square
+    /** Items on the square, an empty list is added if there are none. */
+    std::list<item> &get_items( int x, int y );
+    /** Items on the square, this does not add anything to the submap. */
+    const std::list<item> &get_items( int x, int y ) const;
+    /** Field on the square, an empty field is added if there is none. */
+    field &get_field( int x, int y );
+    const field &get_field( int x, int y ) const;
+    /** Textual "visuals" for the square, an empty map is added if there are none. */
+    std::map<std::string, std::string> &get_cosmetics( int x, int y );
+    const std::map<std::string, std::string> &get_cosmetics( int x, int y ) const;
+    /**
+     * Removes the stored empty item lists, fields and cosmetics. This invalidates
+     * references to them, so it must not be called while any are in use.
+     */
+    void shrink_tile_storage();
+
+    /**
+     * Terrain, furniture, traps, radiation and light of the squares, possibly shared with
+     * other submaps. Read it directly, but change it only through the setters above (or
+     * after calling @ref mutable_tiles), they make sure this submap has its own copy.
+     */
+    std::shared_ptr<submap_tiles> tiles;
+    /** Copies the tiles if they are shared with another submap and returns them. */
+    submap_tiles &mutable_tiles() {
+        if( tiles.use_count() > 1 ) {
+            tiles = std::make_shared<submap_tiles>( *tiles );
+        }
+        return *tiles;
+    }
 
     // If is_uniform is true, this submap is a solid block of terrain
     // Uniform submaps aren't saved/loaded, because regenerating them is faster
     bool is_uniform;
 
-    std::map<std::string, std::string> cosmetics[SEEX][SEEY]; // Textual "visuals" for each square.
+    /*
+     * Items, fields and cosmetics of the squares that have any, most squares have none.
+     * The key is x + y * SEEX, use get_items/get_field/get_cosmetics to access them.
+     * The containers are node based, references to the values stay valid until the
+     * entry is removed (see shrink_tile_storage).
+     */
+    std::unordered_map<int, std::list<item>> tile_items;
+    std::unordered_map<int, field> tile_fields;
+    std::unordered_map<int, std::map<std::string, std::string>> tile_cosmetics;
 
     active_item_cache active_items;
 
@@ -466,8 +550,8 @@ struct submap {
      * TODO: submap owns these pointers, they ought to be unique_ptrs.
      */
     std::vector<vehicle*> vehicles;
-    computer comp;
-    basecamp camp;  // only allowing one basecamp per submap
+    std::unique_ptr<computer> comp; // nullptr if there is no computer
+    std::unique_ptr<basecamp> camp; // only allowing one basecamp per submap, nullptr if none
 
     submap();
     ~submap();
@@ -1194,6 +1194,9 @@ bool mapgen_function_json::setup() {
                luascript += "\n";
            }
        }
+       if( !luascript.empty() ) {
+           luascript_ref = lua_mapgen_compile( luascript );
+       }
 #endif
 
     } catch (std::string e) {
@@ -1293,7 +1296,15 @@ bool jmapgen_setmap::apply( map *m ) {
     return true;
 }
 
-void mapgen_lua(map * m, oter_id id, mapgendata md, int t, float d, const std::string & scr);
+void mapgen_lua(map * m, oter_id id, mapgendata md, int t, float d, int function_ref,
+                const std::string & scr);
+
+mapgen_function_json::~mapgen_function_json() {
+#ifdef LUA
+    lua_mapgen_release( luascript_ref );
+#endif
+}
+
 /*
  * Apply mapgen as per a derived-from-json recipe; in theory fast, but not very versatile
  */
@@ -1308,8 +1319,8 @@ void mapgen_function_json::generate( map *m, oter_id terrain_type, mapgendata md
         elem.apply( m );
     }
 #ifdef LUA
-    if ( ! luascript.empty() ) {
-        mapgen_lua(m, terrain_type, md, t, d, luascript);
+    if ( luascript_ref != 0 ) {
+        mapgen_lua(m, terrain_type, md, t, d, luascript_ref, luascript);
     }
 #else
     (void)md;
@@ -1337,10 +1348,12 @@ void mapgen_function_json::generate( map *m, oter_id terrain_type, mapgendata md
 /*
  * Apply interpreted script; slowest, more versatile eventually.
  */
-void mapgen_lua(map * m,oter_id id,mapgendata md ,int t,float d, const std::string & scr) {
+void mapgen_lua(map * m,oter_id id,mapgendata md ,int t,float d, int function_ref,
+                const std::string & scr) {
 #ifdef LUA
-    lua_mapgen(m, std::string(id), md, t, d, scr);
+    lua_mapgen(m, std::string(id), md, t, d, function_ref, scr);
 #else
+    (void)function_ref;
     (void)scr;
     mapgen_crater(m,id,md,t,d);
     mapf::formatted_set_simple(m, 0, 6,
@@ -1361,9 +1374,26 @@ void mapgen_lua(map * m,oter_id id,mapgendata md ,int t,float d, const std::stri
 #endif
 }
 
+/*
+ * The script is compiled once when it's loaded, generate only runs the compiled chunk.
+ */
+mapgen_function_lua::mapgen_function_lua(std::string s, int w) : mapgen_function( w ), scr(s) {
+#ifdef LUA
+    function_ref = lua_mapgen_compile( scr );
+#else
+    function_ref = 0;
+#endif
+}
+
+mapgen_function_lua::~mapgen_function_lua() {
+#ifdef LUA
+    lua_mapgen_release( function_ref );
+#endif
+}
+
 #ifdef LUA
 void mapgen_function_lua::generate( map *m, oter_id terrain_type, mapgendata dat, int t, float d ) {
-    mapgen_lua(m, terrain_type, dat, t, d, scr );
+    mapgen_lua(m, terrain_type, dat, t, d, function_ref, scr );
 }
 #endif
 
@@ -11672,8 +11702,8 @@ computer *map::add_computer(int x, int y, std::string name, int security)
 {
     ter_set(x, y, t_console); // TODO: Turn this off?
     submap *place_on_submap = get_submap_at(x, y);
-    place_on_submap->comp = computer(name, security);
-    return &(place_on_submap->comp);
+    place_on_submap->comp.reset( new computer( name, security ) );
+    return place_on_submap->comp.get();
 }
 
 /**
@@ -11737,7 +11767,7 @@ void map::rotate(int turns)
 
     std::vector<spawn_point> sprot[MAPSIZE * MAPSIZE];
     std::vector<vehicle*> vehrot[MAPSIZE * MAPSIZE];
-    computer tmpcomp[MAPSIZE * MAPSIZE];
+    std::unique_ptr<computer> tmpcomp[MAPSIZE * MAPSIZE];
     int field_count[MAPSIZE * MAPSIZE];
     int temperature[MAPSIZE * MAPSIZE];
 
@@ -11763,12 +11793,12 @@ void map::rotate(int turns)
             int new_lx, new_ly;
             const auto new_sm = get_submap_at( new_x, new_y, new_lx, new_ly );
             new_sm->is_uniform = false;
-            std::swap( rotated[old_x][old_y], new_sm->ter[new_lx][new_ly] );
-            std::swap( furnrot[old_x][old_y], new_sm->frn[new_lx][new_ly] );
-            std::swap( traprot[old_x][old_y], new_sm->trp[new_lx][new_ly] );
-            std::swap( fldrot[old_x][old_y], new_sm->fld[new_lx][new_ly] );
-            std::swap( radrot[old_x][old_y], new_sm->rad[new_lx][new_ly] );
-            std::swap( cosmetics_rot[old_x][old_y], new_sm->cosmetics[new_lx][new_ly] );
+            rotated[old_x][old_y] = new_sm->get_ter( new_lx, new_ly );
+            furnrot[old_x][old_y] = new_sm->get_furn( new_lx, new_ly );
+            traprot[old_x][old_y] = new_sm->get_trap( new_lx, new_ly );
+            std::swap( fldrot[old_x][old_y], new_sm->get_field( new_lx, new_ly ) );
+            radrot[old_x][old_y] = new_sm->get_radiation( new_lx, new_ly );
+            std::swap( cosmetics_rot[old_x][old_y], new_sm->get_cosmetics( new_lx, new_ly ) );
             auto items = i_at(new_x, new_y);
             itrot[old_x][old_y].reserve( items.size() );
             // Copy items, if we move them, it'll wreck i_clear().
@@ -11820,7 +11850,7 @@ void map::rotate(int turns)
             }
             // as vehrot starts out empty, this clears the other vehicles vector
             vehrot[gridto].swap(from->vehicles);
-            tmpcomp[gridto] = from->comp;
+            tmpcomp[gridto] = std::move( from->comp );
             field_count[gridto] = from->field_count;
             temperature[gridto] = from->temperature;
         }
@@ -11881,7 +11911,7 @@ void map::rotate(int turns)
             // move back to the actuall submap object, vehrot is only temporary
             vehrot[i].swap(to->vehicles);
             sprot[i].swap(to->spawns);
-            to->comp = tmpcomp[i];
+            to->comp = std::move( tmpcomp[i] );
             to->field_count = field_count[i];
             to->temperature = temperature[i];
         }
@@ -11892,12 +11922,12 @@ void map::rotate(int turns)
             int lx, ly;
             const auto sm = get_submap_at( i, j, lx, ly );
             sm->is_uniform = false;
-            std::swap( rotated[i][j], sm->ter[lx][ly] );
-            std::swap( furnrot[i][j], sm->frn[lx][ly] );
-            std::swap( traprot[i][j], sm->trp[lx][ly] );
-            std::swap( fldrot[i][j], sm->fld[lx][ly] );
-            std::swap( radrot[i][j], sm->rad[lx][ly] );
-            std::swap( cosmetics_rot[i][j], sm->cosmetics[lx][ly] );
+            sm->set_ter( lx, ly, rotated[i][j] );
+            sm->set_furn( lx, ly, furnrot[i][j] );
+            sm->set_trap( lx, ly, traprot[i][j] );
+            std::swap( fldrot[i][j], sm->get_field( lx, ly ) );
+            sm->set_radiation( lx, ly, radrot[i][j] );
+            std::swap( cosmetics_rot[i][j], sm->get_cosmetics( lx, ly ) );
             for( auto &itm : itrot[i][j] ) {
                 add_item( i, j, itm );
             }
@@ -11942,6 +11972,8 @@ void map::rotate(int turns)
             }
         }
     }
+    // Terrain and furniture have been swapped directly in the submaps.
+    set_pathing_cache_dirty();
 }
 
 // Hideous function, I admit...
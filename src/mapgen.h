@@ -161,9 +161,9 @@ class mapgen_function_json : public virtual mapgen_function {
         fill_ter = -1;
         is_ready = false;
         do_format = false;
+        luascript_ref = 0;
     }
-    ~mapgen_function_json() {
-    }
+    ~mapgen_function_json();
 
     size_t calc_index( size_t x, size_t y ) const;
 
@@ -203,6 +203,8 @@ class mapgen_function_json : public virtual mapgen_function {
      */
     void load_place_mapings( JsonObject &jsi, const std::string &member_name, placing_map &format_placings );
     std::string luascript;
+    /** luascript compiled by @ref lua_mapgen_compile, 0 if there is none. */
+    int luascript_ref;
 
     bool do_format;
     bool is_ready;
@@ -213,9 +215,10 @@ class mapgen_function_json : public virtual mapgen_function {
 class mapgen_function_lua : public virtual mapgen_function {
     public:
     const std::string scr;
-    mapgen_function_lua(std::string s, int w = 1000) : mapgen_function( w ), scr(s) {
-        // scr = s; // todo; if ( luaL_loadstring(L, scr.c_str() ) ) { error }
-    }
+    /** scr compiled by @ref lua_mapgen_compile, 0 if it could not be compiled. */
+    int function_ref;
+    mapgen_function_lua(std::string s, int w = 1000);
+    ~mapgen_function_lua();
 #if defined(LUA)
     // Prevents instantiating this class in non-lua builds
     virtual void generate(map*, oter_id, mapgendata, int, float);
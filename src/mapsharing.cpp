@@ -1,4 +1,6 @@
 #include "mapsharing.h"
+#include "filesystem.h"
+#include "debug.h"
 
 bool MAP_SHARING::sharing;
 bool MAP_SHARING::competitive;
@@ -131,13 +133,21 @@ void releaseLock( int fd, char const *lockName )
 
 std::map<std::string, int> lockFiles;
 
+// The data is written to this file first and only replaces the actual file
+// once it has been written completely, so a failed or interrupted save
+// leaves the previous version intact.
+static std::string temp_file_name( const char *filename )
+{
+    return std::string( filename ) + ".tmp";
+}
+
 void fopen_exclusive(std::ofstream &fout, const char *filename,
                      std::ios_base::openmode mode)   //TODO: put this in an ofstream_exclusive class?
 {
     std::string lockfile = std::string(filename) + ".lock";
     lockFiles[lockfile] = getLock(lockfile.c_str());
     if(lockFiles[lockfile] != -1) {
-        fout.open(filename, mode);
+        fout.open( temp_file_name( filename ).c_str(), mode );
     }
 }
 /*
@@ -151,10 +161,25 @@ std::ofstream fopen_exclusive(const char* filename) {
     return fout;
 } */
 
-void fclose_exclusive(std::ofstream &fout, const char *filename)
+bool fclose_exclusive(std::ofstream &fout, const char *filename)
 {
     std::string lockFile = std::string(filename) + ".lock";
-    fout.close();
+    bool saved = false;
+    if( fout.is_open() ) {
+        const bool written = fout.good();
+        fout.close();
+        if( written && !fout.fail() ) {
+            // The original file stays in place until the new one replaces it, if that
+            // fails, the new data is kept in the temporary file.
+            saved = rename_file( temp_file_name( filename ), filename );
+            if( !saved ) {
+                debugmsg( "Failed to move %s to %s", temp_file_name( filename ).c_str(), filename );
+            }
+        } else {
+            remove_file( temp_file_name( filename ) );
+        }
+    }
     releaseLock(lockFiles[lockFile], lockFile.c_str());
     lockFiles[lockFile] = -1;
+    return saved;
 }
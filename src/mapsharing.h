@@ -53,9 +53,12 @@ void setDefaults();
 int getLock( char const *lockName );
 void releaseLock( int fd, char const *lockName );
 extern std::map<std::string, int> lockFiles;
+// Opens filename for writing, the output goes to a temporary file that
+// fclose_exclusive moves to filename, if everything has been written.
+// fclose_exclusive returns whether filename has been replaced.
 void fopen_exclusive(std::ofstream &fout, const char *filename,
                      std::ios_base::openmode mode = std::ios_base::out);
 //std::ofstream fopen_exclusive(const char* filename);
-void fclose_exclusive(std::ofstream &fout, const char *filename);
+bool fclose_exclusive(std::ofstream &fout, const char *filename);
 
 #endif
@@ -14,6 +14,8 @@ typedef FreqDef::iterator FreqDef_iter;
 
 struct MonsterGroupEntry {
     std::string name;
+    /** @ref mtype::loadid of name, set by MonsterGroupManager::FinalizeMonsterGroups. */
+    int loadid;
     int frequency;
     int cost_multiplier;
     int pack_minimum;
@@ -31,6 +33,7 @@ struct MonsterGroupEntry {
                       int new_ends)
     {
         name = new_name;
+        loadid = -1;
         frequency = new_freq;
         cost_multiplier = new_cost;
         pack_minimum = new_pack_min;
@@ -60,6 +63,8 @@ struct MonsterGroupResult {
 struct MonsterGroup {
     std::string name;
     std::string defaultMonster;
+    /** @ref mtype::loadid of defaultMonster, see MonsterGroupEntry::loadid. */
+    int default_loadid = -1;
     FreqDef  monsters;
     bool IsMonsterInGroup(const std::string &mtypeid) const;
     // replaces this group after a period of
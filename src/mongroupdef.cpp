@@ -18,6 +18,15 @@
 
 std::map<std::string, MonsterGroup> MonsterGroupManager::monsterGroupMap;
 
+// The type of a monster in a group, by its loadid once the groups have been finalized.
+static const mtype *group_mtype( const std::string &name, const int loadid )
+{
+    if( loadid >= 0 ) {
+        return MonsterGenerator::generator().get_mtype( loadid );
+    }
+    return GetMType( name );
+}
+
 //Quantity is adjusted directly as a side effect of this function
 MonsterGroupResult MonsterGroupManager::GetResultFromGroup(
     std::string group_name, int *quantity, int turn ){
@@ -32,22 +41,23 @@ MonsterGroupResult MonsterGroupManager::GetResultFromGroup(
     MonsterGroupResult spawn_details = MonsterGroupResult(group.defaultMonster, 1);
     //If the default monster is too difficult, replace this with "mon_null"
     if(turn != -1 &&
-       (turn + 900 < MINUTES(STARTING_MINUTES) + HOURS(GetMType(group.defaultMonster)->difficulty))) {
+       (turn + 900 < MINUTES(STARTING_MINUTES) + HOURS(group_mtype(group.defaultMonster, group.default_loadid)->difficulty))) {
         spawn_details = MonsterGroupResult("mon_null", 0);
     }
 
     bool monster_found = false;
     // Step through spawn definitions from the monster group until one is found or
     for (FreqDef_iter it = group.monsters.begin(); it != group.monsters.end() && !monster_found; ++it) {
+        const mtype *type = group_mtype( it->name, it->loadid );
         // There's a lot of conditions to work through to see if this spawn definition is valid
         bool valid_entry = true;
         // I don't know what turn == -1 is checking for, but it makes monsters always valid for difficulty purposes
         valid_entry = valid_entry && (turn == -1 ||
-                                      (turn + 900) >= (MINUTES(STARTING_MINUTES) + HOURS(GetMType(it->name)->difficulty)));
+                                      (turn + 900) >= (MINUTES(STARTING_MINUTES) + HOURS(type->difficulty)));
         // If we are in classic mode, require the monster type to be either CLASSIC or WILDLIFE
         if(ACTIVE_WORLD_OPTIONS["CLASSIC_ZOMBIES"]) {
-            valid_entry = valid_entry && (GetMType(it->name)->in_category("CLASSIC") ||
-                                          GetMType(it->name)->in_category("WILDLIFE"));
+            valid_entry = valid_entry && (type->in_category("CLASSIC") ||
+                                          type->in_category("WILDLIFE"));
         }
         //Insure that the time is not before the spawn first appears or after it stops appearing
         valid_entry = valid_entry && (HOURS(it->starts) < calendar::turn.get_turn());
@@ -245,7 +255,7 @@ bool monster_is_blacklisted(const mtype *m)
 
 void MonsterGroupManager::FinalizeMonsterGroups()
 {
-    const MonsterGenerator &gen = MonsterGenerator::generator();
+    MonsterGenerator &gen = MonsterGenerator::generator();
     for(t_string_set::const_iterator a = monster_whitelist.begin(); a != monster_whitelist.end(); a++) {
         if (!gen.has_mtype(*a)) {
             debugmsg("monster on whitelist %s does not exist", a->c_str());
@@ -268,6 +278,10 @@ void MonsterGroupManager::FinalizeMonsterGroups()
         if(monster_is_blacklisted(gen.GetMType(mg.defaultMonster))) {
             mg.defaultMonster = "mon_null";
         }
+        for( auto &entry : mg.monsters ) {
+            entry.loadid = gen.get_mtype( entry.name )->loadid;
+        }
+        mg.default_loadid = gen.get_mtype( mg.defaultMonster )->loadid;
     }
 }
 
@@ -29,13 +29,15 @@ bool monster::can_move_to(int x, int y) const
     if (g->m.move_cost(x, y) == 0) {
         return false;
     }
-    if (!can_submerge() && g->m.has_flag(TFLAG_DEEP_WATER, x, y)) {
+    // move_cost is 0 outside of the map, so the tile is inbounds here.
+    const uint8_t terrain_flags = g->m.pathing_at(x, y).flags;
+    if (!can_submerge() && (terrain_flags & PF_DEEP_WATER)) {
         return false;
     }
-    if (has_flag(MF_DIGS) && !g->m.has_flag("DIGGABLE", x, y)) {
+    if (has_flag(MF_DIGS) && !(terrain_flags & PF_DIGGABLE)) {
         return false;
     }
-    if (has_flag(MF_AQUATIC) && !g->m.has_flag("SWIMMABLE", x, y)) {
+    if (has_flag(MF_AQUATIC) && !(terrain_flags & PF_SWIMMABLE)) {
         return false;
     }
 
@@ -47,7 +49,7 @@ bool monster::can_move_to(int x, int y) const
     if (has_flag(MF_ANIMAL))
     {
         // don't enter sharp terrain unless tiny, or attacking
-        if (g->m.has_flag("SHARP", x, y) && !(attitude(&(g->u)) == MATT_ATTACK ||
+        if ((terrain_flags & PF_SHARP) && !(attitude(&(g->u)) == MATT_ATTACK ||
                                               type->size == MS_TINY))
             return false;
 
@@ -38,6 +38,7 @@ void MonsterGenerator::reset()
         delete elem.second;
     }
     mon_templates.clear();
+    mon_types.clear();
     for( auto &elem : mon_species ) {
         delete elem.second;
     }
@@ -48,8 +49,11 @@ void MonsterGenerator::reset()
 
 void MonsterGenerator::finalize_mtypes()
 {
+    mon_types.clear();
     for( auto &elem : mon_templates ) {
         mtype *mon = elem.second;
+        mon->loadid = mon_types.size();
+        mon_types.push_back( mon );
         apply_species_attributes(mon);
         set_mtype_flags(mon);
         set_species_ids( mon );
@@ -595,8 +599,6 @@ void MonsterGenerator::load_monster_faction(JsonObject &jo)
 
 mtype *MonsterGenerator::get_mtype(std::string mon)
 {
-    mtype *default_montype = mon_templates["mon_null"];
-
     if (mon == "mon_zombie_fast") {
         mon = "mon_zombie_dog";
     }
@@ -604,11 +606,12 @@ mtype *MonsterGenerator::get_mtype(std::string mon)
         mon = "mon_fungaloid";
     }
 
-    if (mon_templates.find(mon) != mon_templates.end()) {
-        return mon_templates[mon];
+    const auto found = mon_templates.find( mon );
+    if( found != mon_templates.end() ) {
+        return found->second;
     }
     debugmsg("Could not find monster with type %s", mon.c_str());
-    return default_montype;
+    return mon_templates["mon_null"];
 }
 bool MonsterGenerator::has_mtype(const std::string &mon) const
 {
@@ -620,12 +623,8 @@ bool MonsterGenerator::has_species(const std::string &species) const
 }
 mtype *MonsterGenerator::get_mtype(int mon)
 {
-    int count = 0;
-    for( auto &elem : mon_templates ) {
-        if (count == mon) {
-            return elem.second;
-        }
-        ++count;
+    if( mon >= 0 && static_cast<size_t>( mon ) < mon_types.size() ) {
+        return mon_types[mon];
     }
     return mon_templates["mon_null"];
 }
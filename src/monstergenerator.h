@@ -6,6 +6,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 class Creature;
 
@@ -66,6 +67,7 @@ class MonsterGenerator
         void check_monster_definitions() const;
 
         mtype *get_mtype(std::string mon);
+        /** The type with the given @ref mtype::loadid, mon_null if there is none. */
         mtype *get_mtype(int mon);
         bool has_mtype(const std::string &mon) const;
         bool has_species(const std::string &species) const;
@@ -115,6 +117,8 @@ class MonsterGenerator
         template <typename T> void apply_set_to_set(std::set<T> from, std::set<T> &to);
 
         std::map<std::string, mtype *> mon_templates;
+        /** The types in mon_templates indexed by their loadid, filled by finalize_mtypes. */
+        std::vector<mtype *> mon_types;
         std::map<std::string, species_type *> mon_species;
 
         std::map<std::string, phase_id> phase_map;
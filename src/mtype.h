@@ -177,6 +177,11 @@ struct mtype {
         std::string faction_name;
     public:
         std::string id;
+        /**
+         * Index of this type in the list of all types, see @ref MonsterGenerator::get_mtype(int).
+         * Assigned in @ref MonsterGenerator::finalize_mtypes, only valid during one run.
+         */
+        int loadid;
         std::string description;
         std::set<std::string> species, categories;
         std::set< int > species_id;
@@ -6,6 +6,7 @@
 mtype::mtype ()
 {
     id = "mon_null";
+    loadid = -1;
     name = "human";
     name_plural = "humans";
     description = "";
@@ -17,6 +17,23 @@ bool Character::has_trait(const std::string &b) const
     return my_mutations.count( b ) > 0;
 }
 
+bool Character::has_trait( const trait_id &trait ) const
+{
+    return trait.index() < trait_bits.size() && trait_bits[trait.index()];
+}
+
+void Character::update_trait_bits()
+{
+    trait_bits.assign( trait_id::count(), false );
+    for( auto &mut : my_mutations ) {
+        const size_t index = trait_id( mut.first ).index();
+        if( index >= trait_bits.size() ) {
+            trait_bits.resize( index + 1, false );
+        }
+        trait_bits[index] = true;
+    }
+}
+
 bool Character::has_base_trait(const std::string &b) const
 {
     // Look only at base traits
@@ -39,6 +56,7 @@ void Character::toggle_trait(const std::string &flag)
         my_mutations.erase( miter );
         mutation_loss_effect(flag);
     }
+    update_trait_bits();
     recalc_sight_limits();
 }
 
@@ -50,6 +68,7 @@ void Character::toggle_mutation(const std::string &flag)
     } else {
         my_mutations.erase( iter );
     }
+    update_trait_bits();
     recalc_sight_limits();
 }
 
@@ -28,6 +28,28 @@ struct dream {
     }
 };
 
+/**
+ * A trait / mutation id interned to a small integer. Checking whether a character has the
+ * trait through this is a bit lookup (see @ref Character::has_trait), instead of hashing the
+ * string id. Ids are interned on first use, the same string always gets the same index.
+ * Frequently checked traits should use a handle that is created once, e.g.
+ * @code static const trait_id trait_FOO( "FOO" ); @endcode
+ */
+class trait_id {
+    public:
+        explicit trait_id( const std::string &id );
+        /** The string id, as used in the json data. */
+        const std::string &str() const;
+        /** Dense index of the id, 0 up to (not including) @ref count. */
+        size_t index() const {
+            return idx;
+        }
+        /** Number of ids interned so far. */
+        static size_t count();
+    private:
+        size_t idx;
+};
+
 struct mutation_branch {
     using MutationMap = std::unordered_map<std::string, mutation_branch>;
     bool valid = false; // True if this is a valid mutation (False for "unavailable from generic mutagen")
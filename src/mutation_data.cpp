@@ -14,6 +14,44 @@ std::map<std::string, std::vector<std::string> > mutations_category;
 std::map<std::string, mutation_category_trait> mutation_category_traits;
 std::unordered_map<std::string, mutation_branch> mutation_data;
 
+namespace {
+struct trait_id_registry {
+    std::unordered_map<std::string, size_t> indices;
+    std::vector<std::string> ids;
+};
+}
+
+// Function local, the static trait_id handles of other translation units use it during
+// static initialization.
+static trait_id_registry &trait_ids()
+{
+    static trait_id_registry registry;
+    return registry;
+}
+
+trait_id::trait_id( const std::string &id )
+{
+    trait_id_registry &registry = trait_ids();
+    const auto iter = registry.indices.find( id );
+    if( iter != registry.indices.end() ) {
+        idx = iter->second;
+        return;
+    }
+    idx = registry.ids.size();
+    registry.ids.push_back( id );
+    registry.indices.emplace( id, idx );
+}
+
+const std::string &trait_id::str() const
+{
+    return trait_ids().ids[idx];
+}
+
+size_t trait_id::count()
+{
+    return trait_ids().ids.size();
+}
+
 static void extract_mod(JsonObject &j, std::unordered_map<std::pair<bool, std::string>, int> &data,
                         std::string mod_type, bool active, std::string type_key)
 {
@@ -78,6 +116,8 @@ void mutation_branch::load( JsonObject &jsobj )
 {
     const std::string id = jsobj.get_string( "id" );
     mutation_branch &new_mut = mutation_data[id];
+    // Intern the id now, so the indices of all known mutations are assigned up front.
+    static_cast<void>( trait_id( id ) );
 
     JsonArray jsarr;
     new_mut.name = _(jsobj.get_string("name").c_str());
@@ -1873,6 +1873,7 @@ void Character::empty_traits()
 {
     my_traits.clear();
     my_mutations.clear();
+    update_trait_bits();
 }
 void Character::empty_skills()
 {
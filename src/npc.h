@@ -9,6 +9,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #define NPC_LOW_VALUE       5
 #define NPC_HI_VALUE        8
@@ -779,6 +780,42 @@ private:
     void setID (int id);
     bool dead;  // If true, we need to be cleaned up
 
+    /** Whether we could see one of the monsters when its entry was last updated. */
+    struct threat_entry {
+        /** Where the monster was at that time. */
+        point pos;
+        /** Where we were at that time. */
+        point origin;
+        /** Whether the monster was digging or under water at that time. */
+        bool hidden;
+        bool visible;
+        /** The Bresenham slope of the line of sight to the monster, if visible. */
+        int bresenham_slope;
+    };
+    /**
+     * One entry per monster, indexed like g->zombie(). It is rebuilt once per turn, in
+     * between only the monsters that have moved, dug in or submerged are checked again.
+     */
+    std::vector<threat_entry> threats;
+    int threats_turn = -1;
+    /** Brings the threat table up to date, see @ref threats. */
+    void update_threats();
+
+    /** Values (see @ref value) of the items on a square, as last computed by find_item. */
+    struct square_item_values {
+        /** Identifies the items the values were computed for. */
+        size_t fingerprint;
+        /** One value per item, in the order of the items on the square. */
+        std::vector<int> values;
+    };
+    /** Cache of find_item, valid as long as valuation_profile() returns item_values_profile. */
+    std::unordered_map<point, square_item_values> item_value_cache;
+    size_t item_values_profile = 0;
+    /** Hash of the parts of our state that @ref value depends on. */
+    size_t valuation_profile();
+    /** Values of the items on the square, taken from item_value_cache if still valid. */
+    const std::vector<int> &item_values_at( const point &p );
+
     bool is_dangerous_field( const field_entry &fld ) const;
     bool sees_dangerous_field( point p ) const;
     bool could_move_onto( point p ) const;
@@ -457,6 +457,29 @@ void npc::execute_action(npc_action action, int target)
     }
 }
 
+void npc::update_threats()
+{
+    const size_t num_monsters = g->num_zombies();
+    // Moving around during the turn doesn't cause a rebuild, that would check every
+    // monster again on each move.
+    const bool rebuild = threats_turn != int( calendar::turn ) || threats.size() != num_monsters;
+    threats_turn = int( calendar::turn );
+    threats.resize( num_monsters );
+    for( size_t i = 0; i < num_monsters; i++ ) {
+        const monster &mon = g->zombie( i );
+        threat_entry &entry = threats[i];
+        const bool hidden = mon.digging() || mon.is_underwater();
+        if( !rebuild && entry.pos == mon.pos() && entry.hidden == hidden ) {
+            continue;
+        }
+        entry.pos = mon.pos();
+        entry.origin = pos();
+        entry.hidden = hidden;
+        entry.bresenham_slope = 0;
+        entry.visible = sees( mon, entry.bresenham_slope );
+    }
+}
+
 void npc::choose_monster_target(int &enemy, int &danger,
                                 int &total_danger)
 {
@@ -464,9 +487,10 @@ void npc::choose_monster_target(int &enemy, int &danger,
     int highest_priority = 0;
     total_danger = 0;
 
+    update_threats();
     for (size_t i = 0; i < g->num_zombies(); i++) {
         monster *mon = &(g->zombie(i));
-        if (this->sees(*mon)) {
+        if( threats[i].visible ) {
             int distance = (100 * rl_dist(pos(), mon->pos())) / mon->get_speed();
             double hp_percent = (mon->get_hp_max() - mon->get_hp()) / mon->get_hp_max();
             int priority = mon->type->difficulty * (1 + hp_percent) - distance;
@@ -908,7 +932,13 @@ bool npc::wont_hit_friend(int tarx, int tary, int weapon_index)
     }
 
     std::vector<point> traj;
-    if (g->m.sees(posx(), posy(), tarx, tary, dist, linet)) {
+    // The threat table already knows the line to the monsters we can see.
+    const int mondex = g->mon_at( tarx, tary );
+    if( mondex != -1 && size_t( mondex ) < threats.size() && threats_turn == int( calendar::turn ) &&
+        threats[mondex].origin == pos() && threats[mondex].visible &&
+        threats[mondex].pos == point( tarx, tary ) && rl_dist( posx(), posy(), tarx, tary ) <= dist ) {
+        traj = line_to(posx(), posy(), tarx, tary, threats[mondex].bresenham_slope);
+    } else if (g->m.sees(posx(), posy(), tarx, tary, dist, linet)) {
         traj = line_to(posx(), posy(), tarx, tary, linet);
     } else {
         traj = line_to(posx(), posy(), tarx, tary, 0);
@@ -1302,6 +1332,65 @@ void npc::move_pause()
     }
 }
 
+// Entries for squares we've not looked at in a while are only dropped when the cache
+// is reset, this keeps it from growing without bounds.
+const size_t max_item_value_cache_size = 2048;
+
+static void hash_combine( size_t &seed, const size_t value )
+{
+    seed ^= value + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+}
+
+size_t npc::valuation_profile()
+{
+    size_t result = 0;
+    // Hunger and thirst only matter once they are above 40.
+    hash_combine( result, std::max( hunger, 40 ) );
+    hash_combine( result, std::max( thirst, 40 ) );
+    hash_combine( result, std::hash<std::string>()( weapon.typeId() ) );
+    hash_combine( result, weapon.damage );
+    hash_combine( result, weapon.contents.size() );
+    hash_combine( result, std::hash<const Skill *>()( best_skill() ) );
+    hash_combine( result, int_cur );
+    for( auto &skill : Skill::skills ) {
+        hash_combine( result, int( skillLevel( skill ) ) );
+    }
+    // Tools we already have and the guns ammo is for change their value (see npc::value).
+    has_item_with( [&result]( const item & it ) {
+        hash_combine( result, std::hash<std::string>()( it.typeId() ) );
+        if( it.is_gun() ) {
+            hash_combine( result, std::hash<std::string>()( it.ammo_type() ) );
+        }
+        return false;
+    } );
+    hash_combine( result, std::hash<const faction *>()( my_fac ) );
+    return result;
+}
+
+const std::vector<int> &npc::item_values_at( const point &p )
+{
+    auto items = g->m.i_at( p.x, p.y );
+    size_t fingerprint = 0;
+    for( auto &elem : items ) {
+        hash_combine( fingerprint, std::hash<const item *>()( &elem ) );
+        hash_combine( fingerprint, std::hash<std::string>()( elem.typeId() ) );
+        hash_combine( fingerprint, elem.charges );
+        hash_combine( fingerprint, elem.damage );
+        hash_combine( fingerprint, elem.contents.size() );
+    }
+    square_item_values &cached = item_value_cache[p];
+    if( cached.fingerprint == fingerprint && cached.values.size() == items.size() ) {
+        return cached.values;
+    }
+    cached.fingerprint = fingerprint;
+    cached.values.clear();
+    for( auto &elem : items ) {
+        // Don't even consider liquids.
+        cached.values.push_back( elem.made_of( LIQUID ) ? INT_MIN : value( elem ) );
+    }
+    return cached.values;
+}
+
 void npc::find_item()
 {
     fetching_item = false;
@@ -1310,42 +1399,33 @@ void npc::find_item()
     if (range > 12) {
         range = 12;
     }
-    int minx = posx() - range, maxx = posx() + range,
-        miny = posy() - range, maxy = posy() + range;
     const item *wanted = NULL;
-    if (minx < 0) {
-        minx = 0;
-    }
-    if (miny < 0) {
-        miny = 0;
-    }
-    if (maxx >= SEEX * MAPSIZE) {
-        maxx = SEEX * MAPSIZE - 1;
-    }
-    if (maxy >= SEEY * MAPSIZE) {
-        maxy = SEEY * MAPSIZE - 1;
+
+    const size_t profile = valuation_profile();
+    if( profile != item_values_profile || item_value_cache.size() > max_item_value_cache_size ) {
+        item_value_cache.clear();
+        item_values_profile = profile;
     }
 
-    for (int x = minx; x <= maxx; x++) {
-        for (int y = miny; y <= maxy; y++) {
-            if (sees(x, y) && g->m.sees_some_items(x, y, *this)) {
-                for( auto &elem : g->m.i_at(x, y) ) {
-                    if( elem.made_of( LIQUID ) ) {
-                        // Don't even consider liquids.
-                        continue;
-                    }
-                    int itval = value( elem );
-                    int wgt = elem.weight(), vol = elem.volume();
-                    if( itval > best_value &&
-                        //(itval > worst_item_value ||
-                        ( can_pickWeight( wgt, true ) && can_pickVolume( vol, true ) ) ) {
-                        itx = x;
-                        ity = y;
-                        wanted = &( elem );
-                        best_value = itval;
-                        fetching_item = true;
-                    }
-                }
+    for( const point &p : g->m.points_with_items( posx() - range, posy() - range,
+                                                  posx() + range, posy() + range ) ) {
+        if( !g->m.could_see_items( p.x, p.y, *this ) || !sees( p.x, p.y ) ) {
+            continue;
+        }
+        const std::vector<int> &values = item_values_at( p );
+        size_t index = 0;
+        for( auto &elem : g->m.i_at( p.x, p.y ) ) {
+            const int itval = values[index++];
+            if( itval <= best_value ) {
+                continue;
+            }
+            int wgt = elem.weight(), vol = elem.volume();
+            if( can_pickWeight( wgt, true ) && can_pickVolume( vol, true ) ) {
+                itx = p.x;
+                ity = p.y;
+                wanted = &( elem );
+                best_value = itval;
+                fetching_item = true;
             }
         }
     }
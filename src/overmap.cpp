@@ -608,6 +608,27 @@ overmap::overmap(int const x, int const y)
     : loc(x, y)
     , nullret("")
     , nullbool(false)
+{
+    init_settings();
+    init_layers();
+    open();
+}
+
+overmap::overmap(int const x, int const y, const overmap_neighbours &neighbours)
+    : loc(x, y)
+    , nullret("")
+    , nullbool(false)
+{
+    init_settings();
+    init_layers();
+    generate(neighbours);
+}
+
+overmap::~overmap()
+{
+}
+
+void overmap::init_settings()
 {
     // STUB: need region map:
     // settings = regionmap->calculate_settings( loc );
@@ -616,16 +637,28 @@ overmap::overmap(int const x, int const y)
         region_settings_map.find( rsettings_id );
 
     if ( rsit == region_settings_map.end() ) {
-        debugmsg("overmap(%d,%d): can't find region '%s'", x, y, rsettings_id.c_str() ); // gonna die now =[
+        debugmsg("overmap(%d,%d): can't find region '%s'", loc.x, loc.y, rsettings_id.c_str() ); // gonna die now =[
     }
     settings = rsit->second;
-
-    init_layers();
-    open();
 }
 
-overmap::~overmap()
+overmap_border overmap::get_border( int const dx, int const dy ) const
 {
+    overmap_border border;
+    // The row or column on the side, and which coordinate of a road exit is on it.
+    const int fixed = ( dx > 0 ) ? OMAPX - 1 : ( dy > 0 ) ? OMAPY - 1 : 0;
+    const bool along_x = ( dy != 0 );
+    const int length = along_x ? OMAPX : OMAPY;
+    border.terrain.reserve( length );
+    for( int i = 0; i < length; i++ ) {
+        border.terrain.push_back( along_x ? get_ter( i, fixed, 0 ) : get_ter( fixed, i, 0 ) );
+    }
+    for( auto &road : roads_out ) {
+        if( ( along_x ? road.y : road.x ) == fixed ) {
+            border.roads_out.push_back( along_x ? road.x : road.y );
+        }
+    }
+    return border;
 }
 
 void overmap::init_layers()
@@ -826,10 +859,14 @@ point overmap::display_notes(int z)
     return result;
 }
 
-void overmap::generate(const overmap *north, const overmap *east,
-                       const overmap *south, const overmap *west)
+void overmap::generate(const overmap_neighbours &neighbours)
 {
     dbg(D_INFO) << "overmap::generate start...";
+    rng_seed_scope seeded( neighbours.seed );
+    const overmap_border *north = neighbours.north.get();
+    const overmap_border *east = neighbours.east.get();
+    const overmap_border *south = neighbours.south.get();
+    const overmap_border *west = neighbours.west.get();
     std::vector<city> road_points; // cities and roads_out together
     std::vector<point> river_start;// West/North endpoints of rivers
     std::vector<point> river_end; // East/South endpoints of rivers
@@ -839,12 +876,12 @@ void overmap::generate(const overmap *north, const overmap *east,
 
     if (north != NULL) {
         for (int i = 2; i < OMAPX - 2; i++) {
-            if (is_river(north->get_ter(i, OMAPY - 1, 0))) {
+            if (is_river(north->terrain[i])) {
                 ter(i, 0, 0) = river_center;
             }
-            if (is_river(north->get_ter(i, OMAPY - 1, 0)) &&
-                is_river(north->get_ter(i - 1, OMAPY - 1, 0)) &&
-                is_river(north->get_ter(i + 1, OMAPY - 1, 0))) {
+            if (is_river(north->terrain[i]) &&
+                is_river(north->terrain[i - 1]) &&
+                is_river(north->terrain[i + 1])) {
                 if (river_start.empty() ||
                     river_start[river_start.size() - 1].x < i - 6) {
                     river_start.push_back(point(i, 0));
@@ -852,20 +889,18 @@ void overmap::generate(const overmap *north, const overmap *east,
             }
         }
         for (auto &i : north->roads_out) {
-            if (i.y == OMAPY - 1) {
-                roads_out.push_back(city(i.x, 0, 0));
-            }
+            roads_out.push_back(city(i, 0, 0));
         }
     }
     size_t rivers_from_north = river_start.size();
     if (west != NULL) {
         for (int i = 2; i < OMAPY - 2; i++) {
-            if (is_river(west->get_ter(OMAPX - 1, i, 0))) {
+            if (is_river(west->terrain[i])) {
                 ter(0, i, 0) = river_center;
             }
-            if (is_river(west->get_ter(OMAPX - 1, i, 0)) &&
-                is_river(west->get_ter(OMAPX - 1, i - 1, 0)) &&
-                is_river(west->get_ter(OMAPX - 1, i + 1, 0))) {
+            if (is_river(west->terrain[i]) &&
+                is_river(west->terrain[i - 1]) &&
+                is_river(west->terrain[i + 1])) {
                 if (river_start.size() == rivers_from_north ||
                     river_start[river_start.size() - 1].y < i - 6) {
                     river_start.push_back(point(0, i));
@@ -873,56 +908,50 @@ void overmap::generate(const overmap *north, const overmap *east,
             }
         }
         for (auto &i : west->roads_out) {
-            if (i.x == OMAPX - 1) {
-                roads_out.push_back(city(0, i.y, 0));
-            }
+            roads_out.push_back(city(0, i, 0));
         }
     }
     if (south != NULL) {
         for (int i = 2; i < OMAPX - 2; i++) {
-            if (is_river(south->get_ter(i, 0, 0))) {
+            if (is_river(south->terrain[i])) {
                 ter(i, OMAPY - 1, 0) = river_center;
             }
-            if (is_river(south->get_ter(i,     0, 0)) &&
-                is_river(south->get_ter(i - 1, 0, 0)) &&
-                is_river(south->get_ter(i + 1, 0, 0))) {
+            if (is_river(south->terrain[i]) &&
+                is_river(south->terrain[i - 1]) &&
+                is_river(south->terrain[i + 1])) {
                 if (river_end.empty() ||
                     river_end[river_end.size() - 1].x < i - 6) {
                     river_end.push_back(point(i, OMAPY - 1));
                 }
             }
-            if (south->get_ter(i, 0, 0) == "road_nesw") {
+            if (south->terrain[i] == "road_nesw") {
                 roads_out.push_back(city(i, OMAPY - 1, 0));
             }
         }
         for (auto &i : south->roads_out) {
-            if (i.y == 0) {
-                roads_out.push_back(city(i.x, OMAPY - 1, 0));
-            }
+            roads_out.push_back(city(i, OMAPY - 1, 0));
         }
     }
     size_t rivers_to_south = river_end.size();
     if (east != NULL) {
         for (int i = 2; i < OMAPY - 2; i++) {
-            if (is_river(east->get_ter(0, i, 0))) {
+            if (is_river(east->terrain[i])) {
                 ter(OMAPX - 1, i, 0) = river_center;
             }
-            if (is_river(east->get_ter(0, i, 0)) &&
-                is_river(east->get_ter(0, i - 1, 0)) &&
-                is_river(east->get_ter(0, i + 1, 0))) {
+            if (is_river(east->terrain[i]) &&
+                is_river(east->terrain[i - 1]) &&
+                is_river(east->terrain[i + 1])) {
                 if (river_end.size() == rivers_to_south ||
                     river_end[river_end.size() - 1].y < i - 6) {
                     river_end.push_back(point(OMAPX - 1, i));
                 }
             }
-            if (east->get_ter(0, i, 0) == "road_nesw") {
+            if (east->terrain[i] == "road_nesw") {
                 roads_out.push_back(city(OMAPX - 1, i, 0));
             }
         }
         for (auto &i : east->roads_out) {
-            if (i.x == 0) {
-                roads_out.push_back(city(OMAPX - 1, i.y, 0));
-            }
+            roads_out.push_back(city(OMAPX - 1, i, 0));
         }
     }
 
@@ -3214,7 +3243,7 @@ void overmap::place_specials()
                                                                     0 ) ); // normal circumstances
             }
             else{
-                if (rand() % 100 <= special.min_occurrences){ //occurance is actually a % chance, so less than 1
+                if (rng(0, 99) <= special.min_occurrences){ //occurance is actually a % chance, so less than 1
                     num_placed.insert( std::pair<overmap_special, int>(
                         overmap_specials_it, -1 ) ); // Priority add one in this map
                 }
@@ -3510,6 +3539,7 @@ int overmap::get_right_border()
 
 void overmap::place_radios()
 {
+    const size_t first_new = radios.size();
     std::string message;
     for (int i = 0; i < OMAPX; i++) {
         for (int j = 0; j < OMAPY; j++) {
@@ -3543,6 +3573,10 @@ void overmap::place_radios()
             }
         }
     }
+    // Drawn with rng, not rand, so they are the same when this runs in the background.
+    for( size_t i = first_new; i < radios.size(); i++ ) {
+        radios[i].frequency = rng( 0, RAND_MAX );
+    }
 }
 
 
@@ -3557,17 +3591,7 @@ void overmap::open()
         unserialize(fin, plrfilename, terfilename);
         fin.close();
     } else { // No map exists!  Prepare neighbors, and generate one.
-        std::vector<const overmap*> pointers;
-        // Fetch south and north
-        for (int i = -1; i <= 1; i += 2) {
-            pointers.push_back(overmap_buffer.get_existing(loc.x, loc.y+i));
-        }
-        // Fetch east and west
-        for (int i = -1; i <= 1; i += 2) {
-            pointers.push_back(overmap_buffer.get_existing(loc.x+i, loc.y));
-        }
-        // pointers looks like (north, south, west, east)
-        generate(pointers[0], pointers[3], pointers[1], pointers[2]);
+        generate(overmap_buffer.get_neighbours(loc.x, loc.y));
     }
 }
 
@@ -17,6 +17,7 @@
 #include <string>
 #include <stdlib.h>
 #include <array>
+#include <memory>
 
 class overmapbuffer;
 class npc;
@@ -195,6 +196,29 @@ struct city {
  }
 };
 
+/**
+ * The ground level terrain along the side of an overmap that touches a neighbour and the road
+ * exits on that side, both indexed by the position along the side (x for the north and south
+ * side, y for the others), see @ref overmap::get_border.
+ */
+struct overmap_border {
+    std::vector<oter_id> terrain;
+    std::vector<int> roads_out;
+};
+
+/**
+ * Everything a new overmap is generated from, so generation does not need to look at other
+ * overmaps: the borders of the neighbours that exist (null for those that don't) and the seed
+ * of the random numbers.
+ */
+struct overmap_neighbours {
+    unsigned seed = 0;
+    std::unique_ptr<overmap_border> north;
+    std::unique_ptr<overmap_border> east;
+    std::unique_ptr<overmap_border> south;
+    std::unique_ptr<overmap_border> west;
+};
+
 struct om_note {
     std::string text;
     int         x;
@@ -225,7 +249,7 @@ struct radio_tower {
  int frequency;
 radio_tower(int X = -1, int Y = -1, int S = -1, std::string M = "",
             radio_type T = MESSAGE_BROADCAST) :
-    x (X), y (Y), strength (S), type (T), message (M) {frequency = rand();}
+    x (X), y (Y), strength (S), type (T), message (M), frequency (0) {}
 };
 
 struct map_layer {
@@ -252,11 +276,18 @@ class overmap
     overmap(const overmap&) = default;
     overmap(overmap &&) = default;
     overmap(int x, int y);
+    /**
+     * Generates a new overmap, does not load it or look at any other overmap, so this can
+     * be run on another thread. The result only depends on the position and the neighbours.
+     */
+    overmap(int x, int y, const overmap_neighbours &neighbours);
     ~overmap();
 
     overmap& operator=(overmap const&) = default;
 
     point const& pos() const { return loc; }
+    /** The side that touches the overmap (dx, dy) away, one of them 0, the other 1 or -1. */
+    overmap_border get_border( int dx, int dy ) const;
 
     void save() const;
 
@@ -383,8 +414,12 @@ public:
   void unserialize(std::ifstream & fin, std::string const & plrfilename, std::string const & terfilename);
   // parse data in an old overmap file
   bool unserialize_legacy(std::ifstream & fin, std::string const & plrfilename, std::string const & terfilename);
+  // load the layers from the binary files written by save, these throw std::string on errors
+  void unserialize_terrain_layers( std::string const &filename );
+  void unserialize_seen_layers( std::string const &filename );
 
-  void generate(const overmap* north, const overmap* east, const overmap* south, const overmap* west);
+  void init_settings();
+  void generate(const overmap_neighbours &neighbours);
   bool generate_sub(int const z);
 
     int dist_from_city(point p);
@@ -18,6 +18,7 @@ inline int divide(int v, int m, int &r);
 
 overmapbuffer::overmapbuffer()
 : last_requested_overmap( nullptr )
+, seed( 0 )
 {
 }
 
@@ -54,18 +55,126 @@ overmap &overmapbuffer::get( const int x, const int y )
         return *(last_requested_overmap = it->second.get());
     }
 
+    // The overmap in the background might be this one or a neighbour of it, which
+    // would not see this one if it was created first.
+    finish_generation( true );
+    auto const generated = overmaps.find( p );
+    if( generated != overmaps.end() ) {
+        return *(last_requested_overmap = generated->second.get());
+    }
+    generation_queue.erase( std::remove( generation_queue.begin(), generation_queue.end(), p ),
+                            generation_queue.end() );
+
     // That constructor loads an existing overmap or creates a new one.
-    std::unique_ptr<overmap> new_om( new overmap( x, y ) );
+    return add_overmap( std::unique_ptr<overmap>( new overmap( x, y ) ) );
+}
+
+overmap &overmapbuffer::add_overmap( std::unique_ptr<overmap> new_om )
+{
     overmap &result = *new_om;
     overmaps[ new_om->pos() ] = std::move( new_om );
     // Note: fix_mongroups might load other overmaps, so overmaps.back() is not
     // necessarily the overmap at (x,y)
     fix_mongroups( result );
-    
+
     last_requested_overmap = &result;
     return result;
 }
 
+overmap_neighbours overmapbuffer::get_neighbours( const int x, const int y )
+{
+    overmap_neighbours result;
+    result.seed = seed ^ ( static_cast<unsigned>( x ) * 73856093u ) ^
+                  ( static_cast<unsigned>( y ) * 19349663u );
+    if( const overmap *north = get_existing( x, y - 1 ) ) {
+        result.north.reset( new overmap_border( north->get_border( 0, 1 ) ) );
+    }
+    if( const overmap *east = get_existing( x + 1, y ) ) {
+        result.east.reset( new overmap_border( east->get_border( -1, 0 ) ) );
+    }
+    if( const overmap *south = get_existing( x, y + 1 ) ) {
+        result.south.reset( new overmap_border( south->get_border( 0, -1 ) ) );
+    }
+    if( const overmap *west = get_existing( x - 1, y ) ) {
+        result.west.reset( new overmap_border( west->get_border( 1, 0 ) ) );
+    }
+    return result;
+}
+
+overmapbuffer::generated_overmap overmapbuffer::generate_overmap( const point p,
+        const overmap_neighbours &neighbours )
+{
+    generated_overmap result;
+    {
+        // E.g. unknown terrain ids in the overmap specials are reported with debugmsg, and
+        // the monster groups are logged. The collector hands the log over when it ends.
+        debugmsg_collector output( result.errors, result.log );
+        result.om.reset( new overmap( p.x, p.y, neighbours ) );
+    }
+    return result;
+}
+
+void overmapbuffer::start_generation()
+{
+    while( !generating.valid() && !generation_queue.empty() ) {
+        const point p = generation_queue.front();
+        generation_queue.pop_front();
+        if( overmaps.count( p ) > 0 || known_on_disk.count( p ) > 0 ) {
+            continue;
+        }
+        if( known_non_existing.count( p ) == 0 ) {
+            std::ifstream tmp( terrain_filename( p.x, p.y ).c_str(), std::ios::in );
+            if( tmp.is_open() ) {
+                // Loading is quick, it's done when the overmap is needed.
+                known_on_disk.insert( p );
+                continue;
+            }
+            known_non_existing.insert( p );
+        }
+        generating_pos = p;
+        generating = std::async( std::launch::async, generate_overmap, p, get_neighbours( p.x, p.y ) );
+    }
+}
+
+void overmapbuffer::finish_generation( const bool wait )
+{
+    if( !generating.valid() ) {
+        return;
+    }
+    if( !wait && generating.wait_for( std::chrono::seconds( 0 ) ) != std::future_status::ready ) {
+        return;
+    }
+    generated_overmap generated = generating.get();
+    if( overmaps.count( generated.om->pos() ) == 0 ) {
+        add_overmap( std::move( generated.om ) );
+    }
+    write_debug_log( generated.log );
+    show_debugmsgs( generated.errors );
+}
+
+void overmapbuffer::generate_ahead( const tripoint &center, const int radius )
+{
+    finish_generation( false );
+    const point center_om = omt_to_om_copy( center.x, center.y );
+    const point first = omt_to_om_copy( center.x - radius, center.y - radius );
+    const point last = omt_to_om_copy( center.x + radius, center.y + radius );
+    std::vector<point> wanted;
+    for( int x = first.x; x <= last.x; x++ ) {
+        for( int y = first.y; y <= last.y; y++ ) {
+            const point p( x, y );
+            if( overmaps.count( p ) == 0 && known_on_disk.count( p ) == 0 &&
+                !( generating.valid() && generating_pos == p ) ) {
+                wanted.push_back( p );
+            }
+        }
+    }
+    std::sort( wanted.begin(), wanted.end(), [&center_om]( const point & a, const point & b ) {
+        return rl_dist( a, center_om ) < rl_dist( b, center_om );
+    } );
+    generation_queue.assign( wanted.begin(), wanted.end() );
+    start_generation();
+}
+
 void overmapbuffer::fix_mongroups(overmap &new_overmap)
 {
     for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ) {
@@ -108,8 +217,14 @@ void overmapbuffer::save()
 
 void overmapbuffer::clear()
 {
+    if( generating.valid() ) {
+        generating.wait();
+        generating = std::future<generated_overmap>();
+    }
+    generation_queue.clear();
     overmaps.clear();
     known_non_existing.clear();
+    known_on_disk.clear();
     last_requested_overmap = NULL;
 }
 
@@ -144,6 +259,10 @@ overmap *overmapbuffer::get_existing(int x, int y)
     if( it != overmaps.end() ) {
         return last_requested_overmap = it->second.get();
     }
+    if( generating.valid() && generating_pos == p ) {
+        finish_generation( true );
+        return last_requested_overmap = overmaps[p].get();
+    }
     if (known_non_existing.count(p) > 0) {
         // This overmap does not exist on disk (this has already been
         // checked in a previous call of this function).
@@ -5,6 +5,8 @@
 #include "overmap.h"
 #include <set>
 #include <list>
+#include <deque>
+#include <future>
 #include <memory>
 #include <unordered_map>
 
@@ -100,6 +102,29 @@ public:
     void save();
     void clear();
 
+    /**
+     * What a new overmap at (x, y) (overmap coordinates) would be generated from right now,
+     * see @ref overmap_neighbours. Existing neighbours are loaded if needed.
+     */
+    overmap_neighbours get_neighbours( int x, int y );
+    /**
+     * Generates the overmaps that the square of the given radius around center (global
+     * overmap terrain coordinates) reaches into in the background, nearest first, unless
+     * they already exist. One overmap is generated at a time, its neighbours are taken
+     * when it starts. Requesting an overmap that is being generated waits for it, creating
+     * one waits for the one in the background to be done first, so the result is always
+     * the same as if the overmaps had been generated when they were started.
+     * Finished overmaps are added to the buffer by the next call or when they are requested.
+     */
+    void generate_ahead( const tripoint &center, int radius );
+    /** All overmaps of the world are generated from this, it is stored in master.gsav. */
+    unsigned get_seed() const {
+        return seed;
+    }
+    void set_seed( unsigned new_seed ) {
+        seed = new_seed;
+    }
+
     /**
      * Uses global overmap terrain coordinates, creates the
      * overmap if needed.
@@ -396,6 +421,36 @@ private:
     // Cached result of previous call to overmapbuffer::get_existing
     overmap mutable * last_requested_overmap;
 
+    unsigned seed;
+    /** Overmaps to generate in the background, nearest first, see @ref generate_ahead. */
+    std::deque<point> generation_queue;
+    /**
+     * Overmaps that are known to exist on disk, they are not generated in the background
+     * but loaded when they are needed.
+     */
+    std::set<point> known_on_disk;
+    /** An overmap generated in the background and the debug output from generating it. */
+    struct generated_overmap {
+        std::unique_ptr<overmap> om;
+        std::vector<std::string> errors;
+        std::string log;
+    };
+    /** The overmap that is being generated in the background, if generating is valid. */
+    point generating_pos;
+    std::future<generated_overmap> generating;
+    /** Runs on the background thread, so it must not touch the buffer. */
+    static generated_overmap generate_overmap( point p, const overmap_neighbours &neighbours );
+    /** Starts generating the next overmap of the queue if nothing is being generated. */
+    void start_generation();
+    /**
+     * Adds the overmap from the background to the buffer if it is done, or waits for it if
+     * wait is true, and passes on the debug output from generating it. Does nothing if nothing
+     * is being generated.
+     */
+    void finish_generation( bool wait );
+    /** Adds a new overmap to the buffer. */
+    overmap &add_overmap( std::unique_ptr<overmap> new_om );
+
     /**
      * Get a list of notes in the (loaded) overmaps.
      * @param z only this specific z-level is search for notes.
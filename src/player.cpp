@@ -50,6 +50,262 @@ stats player_stats;
 
 static const itype_id OPTICAL_CLOAK_ITEM_ID( "optical_cloak" );
 
+static const trait_id trait_ADDICTIVE( "ADDICTIVE" );
+static const trait_id trait_ADRENALINE( "ADRENALINE" );
+static const trait_id trait_ALBINO( "ALBINO" );
+static const trait_id trait_AMORPHOUS( "AMORPHOUS" );
+static const trait_id trait_ANTENNAE( "ANTENNAE" );
+static const trait_id trait_ANTIFRUIT( "ANTIFRUIT" );
+static const trait_id trait_ANTIJUNK( "ANTIJUNK" );
+static const trait_id trait_ANTIWHEAT( "ANTIWHEAT" );
+static const trait_id trait_ANTLERS( "ANTLERS" );
+static const trait_id trait_ARACHNID_ARMS( "ARACHNID_ARMS" );
+static const trait_id trait_ARACHNID_ARMS_OK( "ARACHNID_ARMS_OK" );
+static const trait_id trait_ARM_FEATHERS( "ARM_FEATHERS" );
+static const trait_id trait_ARM_TENTACLES( "ARM_TENTACLES" );
+static const trait_id trait_ARM_TENTACLES_4( "ARM_TENTACLES_4" );
+static const trait_id trait_ARM_TENTACLES_8( "ARM_TENTACLES_8" );
+static const trait_id trait_ASTHMA( "ASTHMA" );
+static const trait_id trait_BADHEARING( "BADHEARING" );
+static const trait_id trait_BADKNEES( "BADKNEES" );
+static const trait_id trait_BADTEMPER( "BADTEMPER" );
+static const trait_id trait_BARK( "BARK" );
+static const trait_id trait_BEAK( "BEAK" );
+static const trait_id trait_BEAK_HUM( "BEAK_HUM" );
+static const trait_id trait_BEAK_PECK( "BEAK_PECK" );
+static const trait_id trait_BEAUTIFUL( "BEAUTIFUL" );
+static const trait_id trait_BEAUTIFUL2( "BEAUTIFUL2" );
+static const trait_id trait_BEAUTIFUL3( "BEAUTIFUL3" );
+static const trait_id trait_BIRD_EYE( "BIRD_EYE" );
+static const trait_id trait_CANINE_EARS( "CANINE_EARS" );
+static const trait_id trait_CANNIBAL( "CANNIBAL" );
+static const trait_id trait_CARNIVORE( "CARNIVORE" );
+static const trait_id trait_CENOBITE( "CENOBITE" );
+static const trait_id trait_CEPH_EYES( "CEPH_EYES" );
+static const trait_id trait_CEPH_VISION( "CEPH_VISION" );
+static const trait_id trait_CF_HAIR( "CF_HAIR" );
+static const trait_id trait_CHAOTIC( "CHAOTIC" );
+static const trait_id trait_CHEMIMBALANCE( "CHEMIMBALANCE" );
+static const trait_id trait_CHITIN( "CHITIN" );
+static const trait_id trait_CHITIN2( "CHITIN2" );
+static const trait_id trait_CHITIN3( "CHITIN3" );
+static const trait_id trait_CHITIN_FUR( "CHITIN_FUR" );
+static const trait_id trait_CHITIN_FUR2( "CHITIN_FUR2" );
+static const trait_id trait_CHITIN_FUR3( "CHITIN_FUR3" );
+static const trait_id trait_CHLOROMORPH( "CHLOROMORPH" );
+static const trait_id trait_CLAWS_TENTACLE( "CLAWS_TENTACLE" );
+static const trait_id trait_CLUMSY( "CLUMSY" );
+static const trait_id trait_COLDBLOOD( "COLDBLOOD" );
+static const trait_id trait_COLDBLOOD2( "COLDBLOOD2" );
+static const trait_id trait_COLDBLOOD3( "COLDBLOOD3" );
+static const trait_id trait_COLDBLOOD4( "COLDBLOOD4" );
+static const trait_id trait_COMPOUND_EYES( "COMPOUND_EYES" );
+static const trait_id trait_DEBUG_CLOAK( "DEBUG_CLOAK" );
+static const trait_id trait_DEBUG_NOSCENT( "DEBUG_NOSCENT" );
+static const trait_id trait_DEBUG_NOTEMP( "DEBUG_NOTEMP" );
+static const trait_id trait_DEFORMED( "DEFORMED" );
+static const trait_id trait_DEFORMED2( "DEFORMED2" );
+static const trait_id trait_DEFORMED3( "DEFORMED3" );
+static const trait_id trait_DISIMMUNE( "DISIMMUNE" );
+static const trait_id trait_DISRESISTANT( "DISRESISTANT" );
+static const trait_id trait_DOWN( "DOWN" );
+static const trait_id trait_EAGLEEYED( "EAGLEEYED" );
+static const trait_id trait_EASYSLEEPER( "EASYSLEEPER" );
+static const trait_id trait_EATDEAD( "EATDEAD" );
+static const trait_id trait_EATHEALTH( "EATHEALTH" );
+static const trait_id trait_EATPOISON( "EATPOISON" );
+static const trait_id trait_ELFA_FNV( "ELFA_FNV" );
+static const trait_id trait_ELFA_NV( "ELFA_NV" );
+static const trait_id trait_FASTHEALER( "FASTHEALER" );
+static const trait_id trait_FASTHEALER2( "FASTHEALER2" );
+static const trait_id trait_FASTLEARNER( "FASTLEARNER" );
+static const trait_id trait_FASTREADER( "FASTREADER" );
+static const trait_id trait_FAT( "FAT" );
+static const trait_id trait_FEATHERS( "FEATHERS" );
+static const trait_id trait_FELINE_EARS( "FELINE_EARS" );
+static const trait_id trait_FELINE_FUR( "FELINE_FUR" );
+static const trait_id trait_FEL_NV( "FEL_NV" );
+static const trait_id trait_FLEET( "FLEET" );
+static const trait_id trait_FLEET2( "FLEET2" );
+static const trait_id trait_FLIMSY( "FLIMSY" );
+static const trait_id trait_FLIMSY2( "FLIMSY2" );
+static const trait_id trait_FLIMSY3( "FLIMSY3" );
+static const trait_id trait_FLOWERS( "FLOWERS" );
+static const trait_id trait_FORGETFUL( "FORGETFUL" );
+static const trait_id trait_FUR( "FUR" );
+static const trait_id trait_GILLS( "GILLS" );
+static const trait_id trait_GILLS_CEPH( "GILLS_CEPH" );
+static const trait_id trait_GIZZARD( "GIZZARD" );
+static const trait_id trait_GOODHEARING( "GOODHEARING" );
+static const trait_id trait_GOODMEMORY( "GOODMEMORY" );
+static const trait_id trait_GOURMAND( "GOURMAND" );
+static const trait_id trait_HEAVYSLEEPER( "HEAVYSLEEPER" );
+static const trait_id trait_HEAVYSLEEPER2( "HEAVYSLEEPER2" );
+static const trait_id trait_HERBIVORE( "HERBIVORE" );
+static const trait_id trait_HIBERNATE( "HIBERNATE" );
+static const trait_id trait_HOARDER( "HOARDER" );
+static const trait_id trait_HOLLOW_BONES( "HOLLOW_BONES" );
+static const trait_id trait_HOOVES( "HOOVES" );
+static const trait_id trait_HORNS_CURLED( "HORNS_CURLED" );
+static const trait_id trait_HORNS_POINTED( "HORNS_POINTED" );
+static const trait_id trait_HUGE( "HUGE" );
+static const trait_id trait_HUGE_OK( "HUGE_OK" );
+static const trait_id trait_HYPEROPIC( "HYPEROPIC" );
+static const trait_id trait_ILLITERATE( "ILLITERATE" );
+static const trait_id trait_INFIMMUNE( "INFIMMUNE" );
+static const trait_id trait_INFRARED( "INFRARED" );
+static const trait_id trait_INFRESIST( "INFRESIST" );
+static const trait_id trait_INSECT_ARMS( "INSECT_ARMS" );
+static const trait_id trait_INSECT_ARMS_OK( "INSECT_ARMS_OK" );
+static const trait_id trait_INSOMNIA( "INSOMNIA" );
+static const trait_id trait_INT_SLIME( "INT_SLIME" );
+static const trait_id trait_JITTERY( "JITTERY" );
+static const trait_id trait_LACTOSE( "LACTOSE" );
+static const trait_id trait_LARGE( "LARGE" );
+static const trait_id trait_LARGE_OK( "LARGE_OK" );
+static const trait_id trait_LEAVES( "LEAVES" );
+static const trait_id trait_LEG_TENTACLES( "LEG_TENTACLES" );
+static const trait_id trait_LEG_TENT_BRACE( "LEG_TENT_BRACE" );
+static const trait_id trait_LIGHTFUR( "LIGHTFUR" );
+static const trait_id trait_LIGHTSTEP( "LIGHTSTEP" );
+static const trait_id trait_LIGHT_BONES( "LIGHT_BONES" );
+static const trait_id trait_LIZ_IR( "LIZ_IR" );
+static const trait_id trait_LUPINE_EARS( "LUPINE_EARS" );
+static const trait_id trait_LUPINE_FUR( "LUPINE_FUR" );
+static const trait_id trait_LYNX_FUR( "LYNX_FUR" );
+static const trait_id trait_MANDIBLES( "MANDIBLES" );
+static const trait_id trait_MASOCHIST( "MASOCHIST" );
+static const trait_id trait_MASOCHIST_MED( "MASOCHIST_MED" );
+static const trait_id trait_MEATARIAN( "MEATARIAN" );
+static const trait_id trait_MEMBRANE( "MEMBRANE" );
+static const trait_id trait_MET_RAT( "MET_RAT" );
+static const trait_id trait_MINOTAUR( "MINOTAUR" );
+static const trait_id trait_MOODSWINGS( "MOODSWINGS" );
+static const trait_id trait_MOUTH_TENTACLES( "MOUTH_TENTACLES" );
+static const trait_id trait_MUZZLE( "MUZZLE" );
+static const trait_id trait_MUZZLE_BEAR( "MUZZLE_BEAR" );
+static const trait_id trait_MUZZLE_LONG( "MUZZLE_LONG" );
+static const trait_id trait_MUZZLE_RAT( "MUZZLE_RAT" );
+static const trait_id trait_MYOPIC( "MYOPIC" );
+static const trait_id trait_M_BLOSSOMS( "M_BLOSSOMS" );
+static const trait_id trait_M_DEPENDENT( "M_DEPENDENT" );
+static const trait_id trait_M_IMMUNE( "M_IMMUNE" );
+static const trait_id trait_M_SKIN( "M_SKIN" );
+static const trait_id trait_M_SKIN2( "M_SKIN2" );
+static const trait_id trait_M_SPORES( "M_SPORES" );
+static const trait_id trait_NAUSEA( "NAUSEA" );
+static const trait_id trait_NIGHTVISION( "NIGHTVISION" );
+static const trait_id trait_NIGHTVISION2( "NIGHTVISION2" );
+static const trait_id trait_NIGHTVISION3( "NIGHTVISION3" );
+static const trait_id trait_NONADDICTIVE( "NONADDICTIVE" );
+static const trait_id trait_NOPAIN( "NOPAIN" );
+static const trait_id trait_OPTIMISTIC( "OPTIMISTIC" );
+static const trait_id trait_PACIFIST( "PACIFIST" );
+static const trait_id trait_PADDED_FEET( "PADDED_FEET" );
+static const trait_id trait_PAINREC1( "PAINREC1" );
+static const trait_id trait_PAINREC2( "PAINREC2" );
+static const trait_id trait_PAINREC3( "PAINREC3" );
+static const trait_id trait_PAINRESIST( "PAINRESIST" );
+static const trait_id trait_PAINRESIST_TROGLO( "PAINRESIST_TROGLO" );
+static const trait_id trait_PARAIMMUNE( "PARAIMMUNE" );
+static const trait_id trait_PARKOUR( "PARKOUR" );
+static const trait_id trait_PAWS( "PAWS" );
+static const trait_id trait_PAWS_LARGE( "PAWS_LARGE" );
+static const trait_id trait_PER_SLIME( "PER_SLIME" );
+static const trait_id trait_PER_SLIME_OK( "PER_SLIME_OK" );
+static const trait_id trait_PLANTSKIN( "PLANTSKIN" );
+static const trait_id trait_PONDEROUS1( "PONDEROUS1" );
+static const trait_id trait_PONDEROUS2( "PONDEROUS2" );
+static const trait_id trait_PONDEROUS3( "PONDEROUS3" );
+static const trait_id trait_PRED2( "PRED2" );
+static const trait_id trait_PRED3( "PRED3" );
+static const trait_id trait_PRED4( "PRED4" );
+static const trait_id trait_PRETTY( "PRETTY" );
+static const trait_id trait_PROBOSCIS( "PROBOSCIS" );
+static const trait_id trait_PSYCHOPATH( "PSYCHOPATH" );
+static const trait_id trait_QUICK( "QUICK" );
+static const trait_id trait_QUILLS( "QUILLS" );
+static const trait_id trait_RADIOACTIVE1( "RADIOACTIVE1" );
+static const trait_id trait_RADIOACTIVE2( "RADIOACTIVE2" );
+static const trait_id trait_RADIOACTIVE3( "RADIOACTIVE3" );
+static const trait_id trait_RADIOGENIC( "RADIOGENIC" );
+static const trait_id trait_RAP_TALONS( "RAP_TALONS" );
+static const trait_id trait_REGEN( "REGEN" );
+static const trait_id trait_REGEN_LIZ( "REGEN_LIZ" );
+static const trait_id trait_ROOTS( "ROOTS" );
+static const trait_id trait_ROOTS2( "ROOTS2" );
+static const trait_id trait_ROOTS3( "ROOTS3" );
+static const trait_id trait_ROT1( "ROT1" );
+static const trait_id trait_ROT2( "ROT2" );
+static const trait_id trait_ROT3( "ROT3" );
+static const trait_id trait_RUMINANT( "RUMINANT" );
+static const trait_id trait_SABER_TEETH( "SABER_TEETH" );
+static const trait_id trait_SAPIOVORE( "SAPIOVORE" );
+static const trait_id trait_SAPROPHAGE( "SAPROPHAGE" );
+static const trait_id trait_SAPROVORE( "SAPROVORE" );
+static const trait_id trait_SAVANT( "SAVANT" );
+static const trait_id trait_SCALES( "SCALES" );
+static const trait_id trait_SCHIZOPHRENIC( "SCHIZOPHRENIC" );
+static const trait_id trait_SHELL( "SHELL" );
+static const trait_id trait_SHELL2( "SHELL2" );
+static const trait_id trait_SHOUT1( "SHOUT1" );
+static const trait_id trait_SHOUT2( "SHOUT2" );
+static const trait_id trait_SHOUT3( "SHOUT3" );
+static const trait_id trait_SLEEK_SCALES( "SLEEK_SCALES" );
+static const trait_id trait_SLEEPY( "SLEEPY" );
+static const trait_id trait_SLIMESPAWNER( "SLIMESPAWNER" );
+static const trait_id trait_SLIMY( "SLIMY" );
+static const trait_id trait_SLIT_NOSTRILS( "SLIT_NOSTRILS" );
+static const trait_id trait_SLOWHEALER( "SLOWHEALER" );
+static const trait_id trait_SLOWLEARNER( "SLOWLEARNER" );
+static const trait_id trait_SLOWREADER( "SLOWREADER" );
+static const trait_id trait_SLOWRUNNER( "SLOWRUNNER" );
+static const trait_id trait_SMELLY( "SMELLY" );
+static const trait_id trait_SMELLY2( "SMELLY2" );
+static const trait_id trait_SORES( "SORES" );
+static const trait_id trait_SPINES( "SPINES" );
+static const trait_id trait_SPIRITUAL( "SPIRITUAL" );
+static const trait_id trait_STRONGSTOMACH( "STRONGSTOMACH" );
+static const trait_id trait_STYLISH( "STYLISH" );
+static const trait_id trait_SUNBURN( "SUNBURN" );
+static const trait_id trait_SUNLIGHT_DEPENDENT( "SUNLIGHT_DEPENDENT" );
+static const trait_id trait_TAIL_FIN( "TAIL_FIN" );
+static const trait_id trait_TALONS( "TALONS" );
+static const trait_id trait_THICKSKIN( "THICKSKIN" );
+static const trait_id trait_THICK_SCALES( "THICK_SCALES" );
+static const trait_id trait_THINSKIN( "THINSKIN" );
+static const trait_id trait_THORNS( "THORNS" );
+static const trait_id trait_THRESH_CEPHALOPOD( "THRESH_CEPHALOPOD" );
+static const trait_id trait_THRESH_FELINE( "THRESH_FELINE" );
+static const trait_id trait_THRESH_INSECT( "THRESH_INSECT" );
+static const trait_id trait_THRESH_MYCUS( "THRESH_MYCUS" );
+static const trait_id trait_THRESH_PLANT( "THRESH_PLANT" );
+static const trait_id trait_THRESH_SPIDER( "THRESH_SPIDER" );
+static const trait_id trait_THRESH_URSINE( "THRESH_URSINE" );
+static const trait_id trait_TOUGH_FEET( "TOUGH_FEET" );
+static const trait_id trait_TROGLO( "TROGLO" );
+static const trait_id trait_TROGLO2( "TROGLO2" );
+static const trait_id trait_TROGLO3( "TROGLO3" );
+static const trait_id trait_UGLY( "UGLY" );
+static const trait_id trait_UNSTABLE( "UNSTABLE" );
+static const trait_id trait_URSINE_EARS( "URSINE_EARS" );
+static const trait_id trait_URSINE_EYE( "URSINE_EYE" );
+static const trait_id trait_URSINE_FUR( "URSINE_FUR" );
+static const trait_id trait_VEGETARIAN( "VEGETARIAN" );
+static const trait_id trait_VISCOUS( "VISCOUS" );
+static const trait_id trait_VOMITOUS( "VOMITOUS" );
+static const trait_id trait_WAKEFUL3( "WAKEFUL3" );
+static const trait_id trait_WEAKSCENT( "WEAKSCENT" );
+static const trait_id trait_WEAKSTOMACH( "WEAKSTOMACH" );
+static const trait_id trait_WEBBED( "WEBBED" );
+static const trait_id trait_WEB_SPINNER( "WEB_SPINNER" );
+static const trait_id trait_WEB_WALKER( "WEB_WALKER" );
+static const trait_id trait_WEB_WEAVER( "WEB_WEAVER" );
+static const trait_id trait_WHISKERS( "WHISKERS" );
+static const trait_id trait_WHISKERS_RAT( "WHISKERS_RAT" );
+static const trait_id trait_WINGS_BUTTERFLY( "WINGS_BUTTERFLY" );
+static const trait_id trait_WOOLALLERGY( "WOOLALLERGY" );
+
 void game::init_morale()
 {
     std::string tmp_morale_data[NUM_MORALE_TYPES] = {
@@ -282,19 +538,19 @@ void player::reset_stats()
     clear_miss_reasons();
 
     // Trait / mutation buffs
-    if (has_trait("THICK_SCALES")) {
+    if (has_trait( trait_THICK_SCALES )) {
         add_miss_reason(_("Your thick scales get in the way."), 2);
     }
-    if (has_trait("CHITIN2") || has_trait("CHITIN3") || has_trait("CHITIN_FUR3")) {
+    if (has_trait( trait_CHITIN2 ) || has_trait( trait_CHITIN3 ) || has_trait( trait_CHITIN_FUR3 )) {
         add_miss_reason(_("Your chitin gets in the way."), 1);
     }
-    if (has_trait("COMPOUND_EYES") && !wearing_something_on(bp_eyes)) {
+    if (has_trait( trait_COMPOUND_EYES ) && !wearing_something_on(bp_eyes)) {
         mod_per_bonus(1);
     }
-    if (has_trait("INSECT_ARMS")) {
+    if (has_trait( trait_INSECT_ARMS )) {
         add_miss_reason(_("Your insect limbs get in the way."), 2);
     }
-    if (has_trait("INSECT_ARMS_OK")) {
+    if (has_trait( trait_INSECT_ARMS_OK )) {
         if (!wearing_something_on(bp_torso)) {
             mod_dex_bonus(1);
         }
@@ -303,13 +559,13 @@ void player::reset_stats()
             add_miss_reason(_("Your clothing restricts your insect arms."), 1);
         }
     }
-    if (has_trait("WEBBED")) {
+    if (has_trait( trait_WEBBED )) {
         add_miss_reason(_("Your webbed hands get in the way."), 1);
     }
-    if (has_trait("ARACHNID_ARMS")) {
+    if (has_trait( trait_ARACHNID_ARMS )) {
         add_miss_reason(_("Your arachnid limbs get in the way."), 4);
     }
-    if (has_trait("ARACHNID_ARMS_OK")) {
+    if (has_trait( trait_ARACHNID_ARMS_OK )) {
         if (!wearing_something_on(bp_torso)) {
             mod_dex_bonus(2);
         }
@@ -321,15 +577,15 @@ void player::reset_stats()
 
     // Pain
     if (pain > pkill) {
-        if (!(has_trait("CENOBITE"))) {
+        if (!(has_trait( trait_CENOBITE ))) {
             mod_str_bonus(-int((pain - pkill) / 15));
             mod_dex_bonus(-int((pain - pkill) / 15));
             add_miss_reason(_("Your pain distracts you!"), int(pain - pkill) / 15);
         }
         mod_per_bonus(-int((pain - pkill) / 20));
-        if (!(has_trait("INT_SLIME"))) {
+        if (!(has_trait( trait_INT_SLIME ))) {
             mod_int_bonus(-(1 + int((pain - pkill) / 25)));
-        } else if (has_trait("INT_SLIME")) {
+        } else if (has_trait( trait_INT_SLIME )) {
         // Having one's brain throughout one's body does have its downsides.
         // Be glad we don't assess permanent damage.
             mod_int_bonus(-(1 + int(pain - pkill)));
@@ -374,14 +630,14 @@ void player::reset_stats()
     // Dodge-related effects
     mod_dodge_bonus( mabuff_dodge_bonus() - ((encumb(bp_leg_l) / 10) + encumb(bp_leg_r))/20 - (encumb(bp_torso) / 10) );
     // Whiskers don't work so well if they're covered
-    if (has_trait("WHISKERS") && !wearing_something_on(bp_mouth)) {
+    if (has_trait( trait_WHISKERS ) && !wearing_something_on(bp_mouth)) {
         mod_dodge_bonus(1);
     }
-    if (has_trait("WHISKERS_RAT") && !wearing_something_on(bp_mouth)) {
+    if (has_trait( trait_WHISKERS_RAT ) && !wearing_something_on(bp_mouth)) {
         mod_dodge_bonus(2);
     }
     // Spider hair is basically a full-body set of whiskers, once you get the brain for it
-    if (has_trait("CHITIN_FUR3")) {
+    if (has_trait( trait_CHITIN_FUR3 )) {
     static const std::array<body_part, 5> parts {{bp_head, bp_arm_r, bp_arm_l, bp_leg_r, bp_leg_l}};
         for( auto bp : parts ) {
             if( !wearing_something_on( bp ) ) {
@@ -426,26 +682,26 @@ void player::process_turn()
 
     // Set our scent towards the norm
     int norm_scent = 500;
-    if (has_trait("WEAKSCENT")) {
+    if (has_trait( trait_WEAKSCENT )) {
         norm_scent = 300;
     }
-    if (has_trait("SMELLY")) {
+    if (has_trait( trait_SMELLY )) {
         norm_scent = 800;
     }
-    if (has_trait("SMELLY2")) {
+    if (has_trait( trait_SMELLY2 )) {
         norm_scent = 1200;
     }
     // Not so much that you don't have a scent
     // but that you smell like a plant, rather than
     // a human. When was the last time you saw a critter
     // attack a bluebell or an apple tree?
-    if ( (has_trait("FLOWERS")) && (!(has_trait("CHLOROMORPH"))) ) {
+    if ( (has_trait( trait_FLOWERS )) && (!(has_trait( trait_CHLOROMORPH ))) ) {
         norm_scent -= 200;
     }
     // You *are* a plant.  Unless someone hunts triffids by scent,
     // you don't smell like prey.
     // Or maybe you're debugging and would rather not be smelled.
-    if (has_trait("CHLOROMORPH") || has_trait("DEBUG_NOSCENT")) {
+    if (has_trait( trait_CHLOROMORPH ) || has_trait( trait_DEBUG_NOSCENT )) {
         norm_scent = 0;
     }
 
@@ -500,7 +756,7 @@ void player::update_morale()
 void player::apply_persistent_morale()
 {
     // Hoarders get a morale penalty if they're not carrying a full inventory.
-    if (has_trait("HOARDER"))
+    if (has_trait( trait_HOARDER ))
     {
         int pen = int((volume_capacity()-volume_carried()) / 2);
         if (pen > 70)
@@ -524,7 +780,7 @@ void player::apply_persistent_morale()
 
     // The stylish get a morale bonus for each body part covered in an item
     // with the FANCY or SUPER_FANCY tag.
-    if (has_trait("STYLISH"))
+    if (has_trait( trait_STYLISH ))
     {
         int bonus = 0;
         std::string basic_flag = "FANCY";
@@ -577,24 +833,24 @@ void player::apply_persistent_morale()
     }
 
     // Floral folks really don't like having their flowers covered.
-    if( has_trait("FLOWERS") && wearing_something_on(bp_head) ) {
+    if( has_trait( trait_FLOWERS ) && wearing_something_on(bp_head) ) {
         add_morale(MORALE_PERM_CONSTRAINED, -10, -10, 5, 5, true);
     }
 
     // The same applies to rooters and their feet; however, they don't take
     // too many problems from no-footgear.
     double shoe_factor = footwear_factor();
-    if( (has_trait("ROOTS") || has_trait("ROOTS2") || has_trait("ROOTS3") ) &&
+    if( (has_trait( trait_ROOTS ) || has_trait( trait_ROOTS2 ) || has_trait( trait_ROOTS3 ) ) &&
         shoe_factor ) {
         add_morale(MORALE_PERM_CONSTRAINED, -10 * shoe_factor, -10 * shoe_factor, 5, 5, true);
     }
 
     // Masochists get a morale bonus from pain.
-    if (has_trait("MASOCHIST") || has_trait("MASOCHIST_MED") ||  has_trait("CENOBITE")) {
+    if (has_trait( trait_MASOCHIST ) || has_trait( trait_MASOCHIST_MED ) ||  has_trait( trait_CENOBITE )) {
         int bonus = pain / 2.5;
         // Advanced masochists really get a morale bonus from pain.
         // (It's not capped.)
-        if (has_trait("MASOCHIST") && (bonus > 25)) {
+        if (has_trait( trait_MASOCHIST ) && (bonus > 25)) {
             bonus = 25;
         }
         if (has_effect("took_prozac")) {
@@ -607,12 +863,12 @@ void player::apply_persistent_morale()
 
     // Optimist gives a base +4 to morale.
     // The +25% boost from optimist also applies here, for a net of +5.
-    if (has_trait("OPTIMISTIC")) {
+    if (has_trait( trait_OPTIMISTIC )) {
         add_morale(MORALE_PERM_OPTIMIST, 4, 4, 5, 5, true);
     }
 
     // And Bad Temper works just the same way.  But in reverse.  ):
-    if (has_trait("BADTEMPER")) {
+    if (has_trait( trait_BADTEMPER )) {
         add_morale(MORALE_PERM_BADTEMPER, -4, -4, 5, 5, true);
     }
 }
@@ -653,7 +909,7 @@ int player::calc_focus_equilibrium()
     // Factor in pain, since it's harder to rest your mind while your body hurts.
     int eff_morale = morale_level() - pain;
     // Cenobites don't mind, though
-    if (has_trait("CENOBITE")) {
+    if (has_trait( trait_CENOBITE )) {
         eff_morale = eff_morale + pain;
     }
     int focus_gain_rate = 100;
@@ -750,7 +1006,7 @@ HURRICANE : 185 mph (880 hPa) [Ref: Hurricane Wilma]
 
 void player::update_bodytemp()
 {
-    if( has_trait("DEBUG_NOTEMP") ) {
+    if( has_trait( trait_DEBUG_NOTEMP ) ) {
         for( int i = 0 ; i < num_bp ; i++ ) {
             temp_cur[i] = BODYTEMP_NORM;
         }
@@ -825,26 +1081,26 @@ void player::update_bodytemp()
         }
         // Fur, etc effects for sleeping here.
         // Full-power fur is about as effective as a makeshift bed
-        if (has_trait("FUR") || has_trait("LUPINE_FUR") || has_trait("URSINE_FUR")) {
+        if (has_trait( trait_FUR ) || has_trait( trait_LUPINE_FUR ) || has_trait( trait_URSINE_FUR )) {
             floor_mut_warmth += 500;
         }
         // Feline fur, not quite as warm.  Cats do better in warmer spots.
-        if (has_trait("FELINE_FUR")) {
+        if (has_trait( trait_FELINE_FUR )) {
             floor_mut_warmth += 300;
         }
         // Light fur's better than nothing!
-        if (has_trait("LIGHTFUR")) {
+        if (has_trait( trait_LIGHTFUR )) {
             floor_mut_warmth += 100;
         }
         // Spider hair really isn't meant for this sort of thing
-        if (has_trait("CHITIN_FUR")) {
+        if (has_trait( trait_CHITIN_FUR )) {
             floor_mut_warmth += 50;
         }
-        if (has_trait("CHITIN_FUR2") || has_trait("CHITIN_FUR3")) {
+        if (has_trait( trait_CHITIN_FUR2 ) || has_trait( trait_CHITIN_FUR3 )) {
             floor_mut_warmth += 75;
         }
         // Down helps too
-        if (has_trait("DOWN")) {
+        if (has_trait( trait_DOWN )) {
             floor_mut_warmth += 250;
         }
         // Curl up in your shell to conserve heat & stay warm
@@ -853,7 +1109,7 @@ void player::update_bodytemp()
         }
         // DOWN doesn't provide floor insulation, though.
         // Better-than-light fur or being in one's shell does.
-        if ( (!(has_trait("DOWN"))) && (floor_mut_warmth >= 200)) {
+        if ( (!(has_trait( trait_DOWN ))) && (floor_mut_warmth >= 200)) {
             if (floor_bedding_warmth < 0) {
                 floor_bedding_warmth = 0;
             }
@@ -914,7 +1170,7 @@ void player::update_bodytemp()
         }
         // CONVECTION HEAT SOURCES (generates body heat, helps fight frostbite)
         // Bark : lowers blister count to -100; harder to get blisters
-        int blister_count = (has_trait("BARK") ? -100 : 0); // If the counter is high, your skin starts to burn
+        int blister_count = (has_trait( trait_BARK ) ? -100 : 0); // If the counter is high, your skin starts to burn
         int best_fire = 0;
         for (int j = -6 ; j <= 6 ; j++) {
             for (int k = -6 ; k <= 6 ; k++) {
@@ -1114,34 +1370,34 @@ void player::update_bodytemp()
         }
         // MUTATIONS and TRAITS
         // Lightly furred
-        if( has_trait("LIGHTFUR") ) {
+        if( has_trait( trait_LIGHTFUR ) ) {
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 250 : 500);
         }
         // Furry or Lupine/Ursine Fur
-        if( has_trait("FUR") || has_trait("LUPINE_FUR") || has_trait("URSINE_FUR") ) {
+        if( has_trait( trait_FUR ) || has_trait( trait_LUPINE_FUR ) || has_trait( trait_URSINE_FUR ) ) {
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 750 : 1500);
         }
         // Feline fur
-        if( has_trait("FELINE_FUR") ) {
+        if( has_trait( trait_FELINE_FUR ) ) {
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 500 : 1000);
         }
         // Feathers: minor means minor.
-        if( has_trait("FEATHERS") ) {
+        if( has_trait( trait_FEATHERS ) ) {
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 50 : 100);
         }
-        if( has_trait("CHITIN_FUR") ) {
+        if( has_trait( trait_CHITIN_FUR ) ) {
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 100 : 150);
         }
-        if( has_trait("CHITIN_FUR2") || has_trait ("CHITIN_FUR3") ) {
+        if( has_trait( trait_CHITIN_FUR2 ) || has_trait( trait_CHITIN_FUR3 ) ) {
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 150 : 250);
         }
         // Down; lets heat out more easily if needed but not as Warm
         // as full-blown fur.  So less miserable in Summer.
-        if( has_trait("DOWN") ) {
+        if( has_trait( trait_DOWN ) ) {
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 300 : 800);
         }
         // Fat deposits don't hold in much heat, but don't shift for temp
-        if( has_trait("FAT") ) {
+        if( has_trait( trait_FAT ) ) {
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 200 : 200);
         }
         // Being in the shell holds in heat, but lets out less in summer :-/
@@ -1149,19 +1405,19 @@ void player::update_bodytemp()
             temp_conv[i] += (temp_cur[i] > BODYTEMP_NORM ? 500 : 750);
         }
         // Disintegration
-        if (has_trait("ROT1")) {
+        if (has_trait( trait_ROT1 )) {
             temp_conv[i] -= 250;
-        } else if (has_trait("ROT2")) {
+        } else if (has_trait( trait_ROT2 )) {
             temp_conv[i] -= 750;
-        } else if (has_trait("ROT3")) {
+        } else if (has_trait( trait_ROT3 )) {
             temp_conv[i] -= 1500;
         }
         // Radioactive
-        if (has_trait("RADIOACTIVE1")) {
+        if (has_trait( trait_RADIOACTIVE1 )) {
             temp_conv[i] += 250;
-        } else if (has_trait("RADIOACTIVE2")) {
+        } else if (has_trait( trait_RADIOACTIVE2 )) {
             temp_conv[i] += 750;
-        } else if (has_trait("RADIOACTIVE3")) {
+        } else if (has_trait( trait_RADIOACTIVE3 )) {
             temp_conv[i] += 1500;
         }
         // Chemical Imbalance
@@ -1466,7 +1722,7 @@ void player::recalc_speed_bonus()
     if (pain > pkill) {
         int pain_penalty = int((pain - pkill) * .7);
         // Cenobites aren't slowed nearly as much by pain
-        if (has_trait("CENOBITE")) {
+        if (has_trait( trait_CENOBITE )) {
             pain_penalty /= 4;
         }
         if (pain_penalty > 60) {
@@ -1524,22 +1780,22 @@ void player::recalc_speed_bonus()
     // Ectothermic/COLDBLOOD4 is intended to buff folks in the Summer
     // Threshold-crossing has its charms ;-)
     if (g != NULL) {
-        if (has_trait("SUNLIGHT_DEPENDENT") && !g->is_in_sunlight(posx(), posy())) {
+        if (has_trait( trait_SUNLIGHT_DEPENDENT ) && !g->is_in_sunlight(posx(), posy())) {
             mod_speed_bonus(-(g->light_level() >= 12 ? 5 : 10));
         }
-        if ((has_trait("COLDBLOOD4")) && g->get_temperature() > 60) {
+        if ((has_trait( trait_COLDBLOOD4 )) && g->get_temperature() > 60) {
             mod_speed_bonus(+int( (g->get_temperature() - 65) / 2));
         }
-        if ((has_trait("COLDBLOOD3") || has_trait("COLDBLOOD4")) && g->get_temperature() < 60) {
+        if ((has_trait( trait_COLDBLOOD3 ) || has_trait( trait_COLDBLOOD4 )) && g->get_temperature() < 60) {
             mod_speed_bonus(-int( (65 - g->get_temperature()) / 2));
-        } else if (has_trait("COLDBLOOD2") && g->get_temperature() < 60) {
+        } else if (has_trait( trait_COLDBLOOD2 ) && g->get_temperature() < 60) {
             mod_speed_bonus(-int( (65 - g->get_temperature()) / 3));
-        } else if (has_trait("COLDBLOOD") && g->get_temperature() < 60) {
+        } else if (has_trait( trait_COLDBLOOD ) && g->get_temperature() < 60) {
             mod_speed_bonus(-int( (65 - g->get_temperature()) / 5));
         }
     }
 
-    if (has_trait("M_SKIN2")) {
+    if (has_trait( trait_M_SKIN2 )) {
         mod_speed_bonus(-20); // Could be worse--you've got the armor from a (sessile!) Spire
     }
 
@@ -1550,7 +1806,7 @@ void player::recalc_speed_bonus()
         mod_speed_bonus(-20);
     }
 
-    if (has_trait("QUICK")) { // multiply by 1.1
+    if (has_trait( trait_QUICK )) { // multiply by 1.1
         set_speed_bonus(get_speed() * 1.10 - get_speed_base());
     }
     if (has_bionic("bio_speed")) { // multiply by 1.1
@@ -1587,12 +1843,12 @@ int player::run_cost(int base_cost, bool diag)
       (ter_at_pos == t_pavement_bg_dp) || (ter_at_pos == t_pavement_y_bg_dp) ||
       (ter_at_pos == t_linoleum_white) || (ter_at_pos == t_linoleum_gray))) );
 
-    if (has_trait("PARKOUR") && movecost > 100 ) {
+    if (has_trait( trait_PARKOUR ) && movecost > 100 ) {
         movecost *= .5f;
         if (movecost < 100)
             movecost = 100;
     }
-    if (has_trait("BADKNEES") && movecost > 100 ) {
+    if (has_trait( trait_BADKNEES ) && movecost > 100 ) {
         movecost *= 1.25f;
         if (movecost < 100)
             movecost = 100;
@@ -1611,46 +1867,46 @@ int player::run_cost(int base_cost, bool diag)
         movecost += 25;
     }
 
-    if (has_trait("FLEET") && flatground) {
+    if (has_trait( trait_FLEET ) && flatground) {
         movecost *= .85f;
     }
-    if (has_trait("FLEET2") && flatground) {
+    if (has_trait( trait_FLEET2 ) && flatground) {
         movecost *= .7f;
     }
-    if (has_trait("SLOWRUNNER") && flatground) {
+    if (has_trait( trait_SLOWRUNNER ) && flatground) {
         movecost *= 1.15f;
     }
-    if (has_trait("PADDED_FEET") && !footwear_factor()) {
+    if (has_trait( trait_PADDED_FEET ) && !footwear_factor()) {
         movecost *= .9f;
     }
-    if (has_trait("LIGHT_BONES")) {
+    if (has_trait( trait_LIGHT_BONES )) {
         movecost *= .9f;
     }
-    if (has_trait("HOLLOW_BONES")) {
+    if (has_trait( trait_HOLLOW_BONES )) {
         movecost *= .8f;
     }
     if (has_active_mutation("WINGS_INSECT")) {
         movecost *= .75f;
     }
-    if (has_trait("WINGS_BUTTERFLY")) {
+    if (has_trait( trait_WINGS_BUTTERFLY )) {
         movecost -= 10; // You can't fly, but you can make life easier on your legs
     }
-    if (has_trait("LEG_TENTACLES")) {
+    if (has_trait( trait_LEG_TENTACLES )) {
         movecost += 20;
     }
-    if (has_trait("FAT")) {
+    if (has_trait( trait_FAT )) {
         movecost *= 1.05f;
     }
-    if (has_trait("PONDEROUS1")) {
+    if (has_trait( trait_PONDEROUS1 )) {
         movecost *= 1.1f;
     }
-    if (has_trait("PONDEROUS2")) {
+    if (has_trait( trait_PONDEROUS2 )) {
         movecost *= 1.2f;
     }
-    if (has_trait("AMORPHOUS")) {
+    if (has_trait( trait_AMORPHOUS )) {
         movecost *= 1.25f;
     }
-    if (has_trait("PONDEROUS3")) {
+    if (has_trait( trait_PONDEROUS3 )) {
         movecost *= 1.3f;
     }
     if (is_wearing("swim_fins")) {
@@ -1682,16 +1938,16 @@ int player::run_cost(int base_cost, bool diag)
     // ROOTS3 does slow you down as your roots are probing around for nutrients,
     // whether you want them to or not.  ROOTS1 is just too squiggly without shoes
     // to give you some stability.  Plants are a bit of a slow-mover.  Deal.
-    if (!is_wearing_shoes("left") && !has_trait("PADDED_FEET") && !has_trait("HOOVES") &&
-        !has_trait("TOUGH_FEET") && !has_trait("ROOTS2") ) {
+    if (!is_wearing_shoes("left") && !has_trait( trait_PADDED_FEET ) && !has_trait( trait_HOOVES ) &&
+        !has_trait( trait_TOUGH_FEET ) && !has_trait( trait_ROOTS2 ) ) {
         movecost += 8;
     }
-    if (!is_wearing_shoes("right") && !has_trait("PADDED_FEET") && !has_trait("HOOVES") &&
-        !has_trait("TOUGH_FEET") && !has_trait("ROOTS2") ) {
+    if (!is_wearing_shoes("right") && !has_trait( trait_PADDED_FEET ) && !has_trait( trait_HOOVES ) &&
+        !has_trait( trait_TOUGH_FEET ) && !has_trait( trait_ROOTS2 ) ) {
         movecost += 8;
     }
 
-    if( !footwear_factor() && has_trait("ROOTS3") &&
+    if( !footwear_factor() && has_trait( trait_ROOTS3 ) &&
         g->m.has_flag("DIGGABLE", posx(), posy()) ) {
         movecost += 10 * footwear_factor();
     }
@@ -1706,28 +1962,28 @@ int player::run_cost(int base_cost, bool diag)
 int player::swim_speed()
 {
     int ret = 440 + weight_carried() / 60 - 50 * skillLevel("swimming");
-    if (has_trait("PAWS")) {
+    if (has_trait( trait_PAWS )) {
         ret -= 20 + str_cur * 3;
     }
-    if (has_trait("PAWS_LARGE")) {
+    if (has_trait( trait_PAWS_LARGE )) {
         ret -= 20 + str_cur * 4;
     }
     if (is_wearing("swim_fins")) {
         ret -= (15 * str_cur) / (3 - shoe_type_count("swim_fins"));
     }
-    if (has_trait("WEBBED")) {
+    if (has_trait( trait_WEBBED )) {
         ret -= 60 + str_cur * 5;
     }
-    if (has_trait("TAIL_FIN")) {
+    if (has_trait( trait_TAIL_FIN )) {
         ret -= 100 + str_cur * 10;
     }
-    if (has_trait("SLEEK_SCALES")) {
+    if (has_trait( trait_SLEEK_SCALES )) {
         ret -= 100;
     }
-    if (has_trait("LEG_TENTACLES")) {
+    if (has_trait( trait_LEG_TENTACLES )) {
         ret -= 60;
     }
-    if (has_trait("FAT")) {
+    if (has_trait( trait_FAT )) {
         ret -= 30;
     }
     ret += (50 - skillLevel("swimming") * 2) * ((encumb(bp_leg_l) + encumb(bp_leg_r)) / 10);
@@ -1802,7 +2058,7 @@ nc_color player::basic_symbol_color() const
         return c_blue;
     }
     if (has_active_bionic("bio_cloak") || has_artifact_with(AEP_INVISIBLE) ||
-          has_active_optcloak() || has_trait("DEBUG_CLOAK")) {
+          has_active_optcloak() || has_trait( trait_DEBUG_CLOAK )) {
         return c_dkgray;
     }
     return c_white;
@@ -2290,7 +2546,7 @@ void player::disp_info()
         effect_name.push_back(_("Pain"));
         std::stringstream pain_text;
         // Cenobites aren't markedly physically impaired by pain.
-        if ((pain - pkill >= 15) && (!(has_trait("CENOBITE")))) {
+        if ((pain - pkill >= 15) && (!(has_trait( trait_CENOBITE )))) {
             pain_text << _("Strength") << " -" << int((pain - pkill) / 15) << "   " << _("Dexterity") << " -" <<
                 int((pain - pkill) / 15) << "   ";
         }
@@ -2335,18 +2591,18 @@ void player::disp_info()
         effect_text.push_back(stim_text.str());
     }
 
-    if ((has_trait("TROGLO") && g->is_in_sunlight(posx(), posy()) &&
+    if ((has_trait( trait_TROGLO ) && g->is_in_sunlight(posx(), posy()) &&
          g->weather == WEATHER_SUNNY) ||
-        (has_trait("TROGLO2") && g->is_in_sunlight(posx(), posy()) &&
+        (has_trait( trait_TROGLO2 ) && g->is_in_sunlight(posx(), posy()) &&
          g->weather != WEATHER_SUNNY)) {
         effect_name.push_back(_("In Sunlight"));
         effect_text.push_back(_("The sunlight irritates you.\n\
 Strength - 1;    Dexterity - 1;    Intelligence - 1;    Perception - 1"));
-    } else if (has_trait("TROGLO2") && g->is_in_sunlight(posx(), posy())) {
+    } else if (has_trait( trait_TROGLO2 ) && g->is_in_sunlight(posx(), posy())) {
         effect_name.push_back(_("In Sunlight"));
         effect_text.push_back(_("The sunlight irritates you badly.\n\
 Strength - 2;    Dexterity - 2;    Intelligence - 2;    Perception - 2"));
-    } else if (has_trait("TROGLO3") && g->is_in_sunlight(posx(), posy())) {
+    } else if (has_trait( trait_TROGLO3 ) && g->is_in_sunlight(posx(), posy())) {
         effect_name.push_back(_("In Sunlight"));
         effect_text.push_back(_("The sunlight irritates you terribly.\n\
 Strength - 4;    Dexterity - 4;    Intelligence - 4;    Perception - 4"));
@@ -2712,7 +2968,7 @@ Strength - 4;    Dexterity - 4;    Intelligence - 4;    Perception - 4"));
         line++;
     }
     pen = int((pain - pkill) * .7);
-    if (has_trait("CENOBITE")) {
+    if (has_trait( trait_CENOBITE )) {
         pen /= 4;
     }
     if (pen > 60)
@@ -2750,24 +3006,24 @@ Strength - 4;    Dexterity - 4;    Intelligence - 4;    Perception - 4"));
                   (pen < 10 ? " " : ""), pen);
         line++;
     }
-    if (has_trait("SUNLIGHT_DEPENDENT") && !g->is_in_sunlight(posx(), posy())) {
+    if (has_trait( trait_SUNLIGHT_DEPENDENT ) && !g->is_in_sunlight(posx(), posy())) {
         pen = (g->light_level() >= 12 ? 5 : 10);
         mvwprintz(w_speed, line, 1, c_red, _("Out of Sunlight     -%s%d%%"),
                   (pen < 10 ? " " : ""), pen);
         line++;
     }
-    if (has_trait ("COLDBLOOD4") && g->get_temperature() > 65) {
+    if (has_trait( trait_COLDBLOOD4 ) && g->get_temperature() > 65) {
         pen = int( (g->get_temperature() - 65) / 2);
         mvwprintz(w_speed, line, 1, c_green, _("Cold-Blooded        +%s%d%%"),
                   (pen < 10 ? " " : ""), pen);
         line++;
     }
-    if ((has_trait("COLDBLOOD") || has_trait("COLDBLOOD2") ||
-         has_trait("COLDBLOOD3") || has_trait("COLDBLOOD4")) &&
+    if ((has_trait( trait_COLDBLOOD ) || has_trait( trait_COLDBLOOD2 ) ||
+         has_trait( trait_COLDBLOOD3 ) || has_trait( trait_COLDBLOOD4 )) &&
         g->get_temperature() < 65) {
-        if (has_trait("COLDBLOOD3") || has_trait("COLDBLOOD4")) {
+        if (has_trait( trait_COLDBLOOD3 ) || has_trait( trait_COLDBLOOD4 )) {
             pen = int( (65 - g->get_temperature()) / 2);
-        } else if (has_trait("COLDBLOOD2")) {
+        } else if (has_trait( trait_COLDBLOOD2 )) {
             pen = int( (65 - g->get_temperature()) / 3);
         } else {
             pen = int( (65 - g->get_temperature()) / 5);
@@ -2802,11 +3058,11 @@ Strength - 4;    Dexterity - 4;    Intelligence - 4;    Perception - 4"));
 
     int quick_bonus = int(newmoves - (newmoves / 1.1));
     int bio_speed_bonus = quick_bonus;
-    if (has_trait("QUICK") && has_bionic("bio_speed")) {
+    if (has_trait( trait_QUICK ) && has_bionic("bio_speed")) {
         bio_speed_bonus = int(newmoves/1.1 - (newmoves / 1.1 / 1.1));
         std::swap(quick_bonus, bio_speed_bonus);
     }
-    if (has_trait("QUICK")) {
+    if (has_trait( trait_QUICK )) {
         mvwprintz(w_speed, line, 1, c_green, _("Quick               +%s%d%%"),
                   (quick_bonus < 10 ? " " : ""), quick_bonus);
         line++;
@@ -3604,8 +3860,8 @@ void player::disp_status(WINDOW *w, WINDOW *w2)
     const char *morale_str;
     if      (morale_cur >= 200) morale_str = "8D";
     else if (morale_cur >= 100) morale_str = ":D";
-    else if (has_trait("THRESH_FELINE") && morale_cur >= 10)  morale_str = ":3";
-    else if (!has_trait("THRESH_FELINE") && morale_cur >= 10)  morale_str = ":)";
+    else if (has_trait( trait_THRESH_FELINE ) && morale_cur >= 10)  morale_str = ":3";
+    else if (!has_trait( trait_THRESH_FELINE ) && morale_cur >= 10)  morale_str = ":)";
     else if (morale_cur > -10)  morale_str = ":|";
     else if (morale_cur > -100) morale_str = "):";
     else if (morale_cur > -200) morale_str = "D:";
@@ -4087,7 +4343,7 @@ int player::sight_range(int light_level) const
 int player::unimpaired_range()
 {
  int ret = DAYLIGHT_LEVEL;
- if (has_trait("PER_SLIME")) {
+ if (has_trait( trait_PER_SLIME )) {
     ret = 6;
  }
  if (has_active_mutation("SHELL2")) {
@@ -4132,27 +4388,27 @@ int player::overmap_sight_range(int light_level)
         return (sight / (SEEX / 2) );
     }
     if ((has_amount("binoculars", 1) || has_amount("rifle_scope", 1) ||
-        -1 != weapon.has_gunmod("rifle_scope") ) && !has_trait("EAGLEEYED"))  {
-        if (has_trait("BIRD_EYE")) {
+        -1 != weapon.has_gunmod("rifle_scope") ) && !has_trait( trait_EAGLEEYED ))  {
+        if (has_trait( trait_BIRD_EYE )) {
             return 25;
         }
         return 20;
     }
     else if (!(has_amount("binoculars", 1) || has_amount("rifle_scope", 1) ||
-        -1 != weapon.has_gunmod("rifle_scope") ) && has_trait("EAGLEEYED"))  {
-        if (has_trait("BIRD_EYE")) {
+        -1 != weapon.has_gunmod("rifle_scope") ) && has_trait( trait_EAGLEEYED ))  {
+        if (has_trait( trait_BIRD_EYE )) {
             return 25;
         }
         return 20;
     }
     else if ((has_amount("binoculars", 1) || has_amount("rifle_scope", 1) ||
-        -1 != weapon.has_gunmod("rifle_scope") ) && has_trait("EAGLEEYED"))  {
-        if (has_trait("BIRD_EYE")) {
+        -1 != weapon.has_gunmod("rifle_scope") ) && has_trait( trait_EAGLEEYED ))  {
+        if (has_trait( trait_BIRD_EYE )) {
             return 30;
         }
         return 25;
     }
-    else if (has_trait("BIRD_EYE")) {
+    else if (has_trait( trait_BIRD_EYE )) {
             return 15;
         }
     return 10;
@@ -4172,16 +4428,16 @@ int player::clairvoyance() const
 
 bool player::sight_impaired()
 {
- return ((has_effect("boomered") && (!(has_trait("PER_SLIME_OK")))) ||
-  (underwater && !has_bionic("bio_membrane") && !has_trait("MEMBRANE") &&
-              !worn_with_flag("SWIM_GOGGLES") && !has_trait("PER_SLIME_OK") &&
-              !has_trait("CEPH_EYES") ) ||
-  ((has_trait("MYOPIC") || has_trait("URSINE_EYE") ) &&
+ return ((has_effect("boomered") && (!(has_trait( trait_PER_SLIME_OK )))) ||
+  (underwater && !has_bionic("bio_membrane") && !has_trait( trait_MEMBRANE ) &&
+              !worn_with_flag("SWIM_GOGGLES") && !has_trait( trait_PER_SLIME_OK ) &&
+              !has_trait( trait_CEPH_EYES ) ) ||
+  ((has_trait( trait_MYOPIC ) || has_trait( trait_URSINE_EYE ) ) &&
                         !is_wearing("glasses_eye") &&
                         !is_wearing("glasses_monocle") &&
                         !is_wearing("glasses_bifocal") &&
                         !has_effect("contacts")) ||
-   has_trait("PER_SLIME"));
+   has_trait( trait_PER_SLIME ));
 }
 
 bool player::has_two_arms() const
@@ -4204,11 +4460,11 @@ bool player::avoid_trap( const tripoint &pos, const trap &tr )
         traproll = dice( 6, tr.get_avoidance() );
     }
 
-    if( has_trait( "LIGHTSTEP" ) ) {
+    if( has_trait( trait_LIGHTSTEP ) ) {
         myroll += dice( 2, 6 );
     }
 
-    if( has_trait( "CLUMSY" ) ) {
+    if( has_trait( trait_CLUMSY ) ) {
         myroll -= dice( 2, 6 );
     }
 
@@ -4394,9 +4650,9 @@ int player::read_speed(bool return_stat_effect)
   // Stat window shows stat effects on based on current stat
  int intel = (return_stat_effect ? get_int() : get_int());
  int ret = 1000 - 50 * (intel - 8);
- if (has_trait("FASTREADER"))
+ if (has_trait( trait_FASTREADER ))
   ret *= .8;
- if (has_trait("SLOWREADER"))
+ if (has_trait( trait_SLOWREADER ))
   ret *= 1.3;
  if (ret < 100)
   ret = 100;
@@ -4414,11 +4670,11 @@ int player::rust_rate(bool return_stat_effect)
     int intel = (return_stat_effect ? get_int() : get_int());
     int ret = ((OPTIONS["SKILL_RUST"] == "vanilla" || OPTIONS["SKILL_RUST"] == "capped") ? 500 : 500 - 35 * (intel - 8));
 
-    if (has_trait("FORGETFUL")) {
+    if (has_trait( trait_FORGETFUL )) {
         ret *= 1.33;
     }
 
-    if (has_trait("GOODMEMORY")) {
+    if (has_trait( trait_GOODMEMORY )) {
         ret *= .66;
     }
 
@@ -4433,23 +4689,23 @@ int player::rust_rate(bool return_stat_effect)
 int player::talk_skill()
 {
     int ret = get_int() + get_per() + skillLevel("speech") * 3;
-    if (has_trait("SAPIOVORE")) {
+    if (has_trait( trait_SAPIOVORE )) {
         ret -= 20; // Friendly convo with your prey? unlikely
-    } else if (has_trait("UGLY")) {
+    } else if (has_trait( trait_UGLY )) {
         ret -= 3;
-    } else if (has_trait("DEFORMED")) {
+    } else if (has_trait( trait_DEFORMED )) {
         ret -= 6;
-    } else if (has_trait("DEFORMED2")) {
+    } else if (has_trait( trait_DEFORMED2 )) {
         ret -= 12;
-    } else if (has_trait("DEFORMED3")) {
+    } else if (has_trait( trait_DEFORMED3 )) {
         ret -= 18;
-    } else if (has_trait("PRETTY")) {
+    } else if (has_trait( trait_PRETTY )) {
         ret += 1;
-    } else if (has_trait("BEAUTIFUL")) {
+    } else if (has_trait( trait_BEAUTIFUL )) {
         ret += 2;
-    } else if (has_trait("BEAUTIFUL2")) {
+    } else if (has_trait( trait_BEAUTIFUL2 )) {
         ret += 4;
-    } else if (has_trait("BEAUTIFUL3")) {
+    } else if (has_trait( trait_BEAUTIFUL3 )) {
         ret += 6;
     }
     return ret;
@@ -4464,15 +4720,15 @@ int player::intimidation()
     if (weapon.damage_bash() >= 12 || weapon.damage_cut() >= 12) {
         ret += 5;
     }
-    if (has_trait("SAPIOVORE")) {
+    if (has_trait( trait_SAPIOVORE )) {
         ret += 5; // Scaring one's prey, on the other claw...
-    } else if (has_trait("DEFORMED2")) {
+    } else if (has_trait( trait_DEFORMED2 )) {
         ret += 3;
-    } else if (has_trait("DEFORMED3")) {
+    } else if (has_trait( trait_DEFORMED3 )) {
         ret += 6;
-    } else if (has_trait("PRETTY")) {
+    } else if (has_trait( trait_PRETTY )) {
         ret -= 1;
-    } else if (has_trait("BEAUTIFUL") || has_trait("BEAUTIFUL2") || has_trait("BEAUTIFUL3")) {
+    } else if (has_trait( trait_BEAUTIFUL ) || has_trait( trait_BEAUTIFUL2 ) || has_trait( trait_BEAUTIFUL3 )) {
         ret -= 4;
     }
     if (stim > 20) {
@@ -4505,24 +4761,24 @@ void player::on_gethit(Creature *source, body_part bp_hit, damage_instance &) {
             ods_shock_damage.add_damage(DT_ELECTRIC, rng(10,40));
             source->deal_damage(this, bp_torso, ods_shock_damage);
         }
-        if ((!(wearing_something_on(bp_hit))) && (has_trait("SPINES") || has_trait("QUILLS"))) {
-            int spine = rng(1, (has_trait("QUILLS") ? 20 : 8));
+        if ((!(wearing_something_on(bp_hit))) && (has_trait( trait_SPINES ) || has_trait( trait_QUILLS ))) {
+            int spine = rng(1, (has_trait( trait_QUILLS ) ? 20 : 8));
             if (!is_player()) {
                 if( u_see ) {
                     add_msg(_("%1$s's %2$s puncture %s in mid-attack!"), name.c_str(),
-                                (has_trait("QUILLS") ? _("quills") : _("spines")),
+                                (has_trait( trait_QUILLS ) ? _("quills") : _("spines")),
                                 source->disp_name().c_str());
                 }
             } else {
                 add_msg(m_good, _("Your %s puncture %s in mid-attack!"),
-                                (has_trait("QUILLS") ? _("quills") : _("spines")),
+                                (has_trait( trait_QUILLS ) ? _("quills") : _("spines")),
                                 source->disp_name().c_str());
             }
             damage_instance spine_damage;
             spine_damage.add_damage(DT_STAB, spine);
             source->deal_damage(this, bp_torso, spine_damage);
         }
-        if ((!(wearing_something_on(bp_hit))) && (has_trait("THORNS")) && (!(source->has_weapon()))) {
+        if ((!(wearing_something_on(bp_hit))) && (has_trait( trait_THORNS )) && (!(source->has_weapon()))) {
             if (!is_player()) {
                 if( u_see ) {
                     add_msg(_("%1$s's %2$s scrape %s in mid-attack!"), name.c_str(),
@@ -4538,7 +4794,7 @@ void player::on_gethit(Creature *source, body_part bp_hit, damage_instance &) {
             // so safer to target the torso
             source->deal_damage(this, bp_torso, thorn_damage);
         }
-        if ((!(wearing_something_on(bp_hit))) && (has_trait("CF_HAIR"))) {
+        if ((!(wearing_something_on(bp_hit))) && (has_trait( trait_CF_HAIR ))) {
             if (!is_player()) {
                 if( u_see ) {
                     add_msg(_("%1$s gets a load of %2$s's %s stuck in!"), source->disp_name().c_str(),
@@ -4617,7 +4873,7 @@ dealt_damage_instance player::deal_damage(Creature* source, body_part bp, const
     }
 
     // And slimespawners too
-    if ((has_trait("SLIMESPAWNER")) && (dam >= 10) && one_in(20 - dam)) {
+    if ((has_trait( trait_SLIMESPAWNER )) && (dam >= 10) && one_in(20 - dam)) {
         std::vector<point> valid;
         for (int x = posx() - 1; x <= posx() + 1; x++) {
             for (int y = posy() - 1; y <= posy() + 1; y++) {
@@ -4639,7 +4895,7 @@ dealt_damage_instance player::deal_damage(Creature* source, body_part bp, const
         }
     }
 
-    if (has_trait("ADRENALINE") && !has_effect("adrenaline") &&
+    if (has_trait( trait_ADRENALINE ) && !has_effect("adrenaline") &&
         (hp_cur[hp_head] < 25 || hp_cur[hp_torso] < 15)) {
         add_effect("adrenaline", 200);
     }
@@ -4747,15 +5003,15 @@ dealt_damage_instance player::deal_damage(Creature* source, body_part bp, const
 }
 
 void player::mod_pain(int npain) {
-    if ((has_trait("NOPAIN"))) {
+    if ((has_trait( trait_NOPAIN ))) {
         return;
     }
-    if (has_trait("PAINRESIST") && npain > 1) {
+    if (has_trait( trait_PAINRESIST ) && npain > 1) {
         // if it's 1 it'll just become 0, which is bad
         npain = npain * 4 / rng(4,8);
     }
     // Dwarves get better pain-resist, what with mining and all
-    if (has_trait("PAINRESIST_TROGLO") && npain > 1) {
+    if (has_trait( trait_PAINRESIST_TROGLO ) && npain > 1) {
         npain = npain * 4 / rng(6,9);
     }
     if (!is_npc() && ((npain >= 1) && (rng(0, pain) >= 10))) {
@@ -4826,7 +5082,7 @@ void player::apply_damage(Creature *source, body_part hurt, int dam)
 
     mod_pain( dam /2 );
 
-    if (has_trait("ADRENALINE") && !has_effect("adrenaline") &&
+    if (has_trait( trait_ADRENALINE ) && !has_effect("adrenaline") &&
         (hp_cur[hp_head] < 25 || hp_cur[hp_torso] < 15)) {
         add_effect("adrenaline", 200);
     }
@@ -5055,12 +5311,12 @@ int player::hp_percentage() const
 
 void player::get_sick()
 {
-    if (has_trait("DISIMMUNE")) {
+    if (has_trait( trait_DISIMMUNE )) {
         return;
     }
 
     if (!has_effect("flu") && !has_effect("common_cold") &&
-        one_in(900 + get_healthy() + (has_trait("DISRESISTANT") ? 300 : 0))) {
+        one_in(900 + get_healthy() + (has_trait( trait_DISRESISTANT ) ? 300 : 0))) {
         if (one_in(6) && !has_effect("flushot")) {
             add_env_effect("flu", bp_mouth, 3, rng(40000, 80000));
         } else {
@@ -5233,11 +5489,11 @@ void player::add_addiction(add_type type, int strength)
         return;
     }
     int timer = 1200;
-    if (has_trait("ADDICTIVE")) {
+    if (has_trait( trait_ADDICTIVE )) {
         strength = int(strength * 1.5);
         timer = 800;
     }
-    if (has_trait("NONADDICTIVE")) {
+    if (has_trait( trait_NONADDICTIVE )) {
         strength = int(strength * .50);
         timer = 1800;
     }
@@ -5284,7 +5540,7 @@ void player::rem_addiction(add_type type)
     for (size_t i = 0; i < addictions.size(); i++) {
         if (addictions[i].type == type) {
             //~ %s is addiction name
-            if (has_trait("THRESH_MYCUS") && ((type == ADD_MARLOSS_R) || (type == ADD_MARLOSS_B) ||
+            if (has_trait( trait_THRESH_MYCUS ) && ((type == ADD_MARLOSS_R) || (type == ADD_MARLOSS_B) ||
               (type == ADD_MARLOSS_Y))) {
                   add_memorial_log(pgettext("memorial_male", "Transcended addiction to %s."),
                             pgettext("memorial_female", "Transcended addiction to %s."),
@@ -5360,7 +5616,7 @@ void player::cough(bool harmful, int loudness) {
 
 void player::add_pain_msg(int val, body_part bp)
 {
-    if (has_trait("NOPAIN")) {
+    if (has_trait( trait_NOPAIN )) {
         return;
     }
     if (bp == num_bp) {
@@ -5482,12 +5738,12 @@ void player::process_effects() {
     if (has_effect("darkness") && g->is_in_sunlight(posx(), posy())) {
         remove_effect("darkness");
     }
-    if (has_trait("M_IMMUNE") && has_effect("fungus")) {
+    if (has_trait( trait_M_IMMUNE ) && has_effect("fungus")) {
         vomit();
         remove_effect("fungus");
         add_msg_if_player(m_bad,  _("We have mistakenly colonized a local guide!  Purging now."));
     }
-    if (has_trait("PARAIMMUNE") && (has_effect("dermatik") || has_effect("tapeworm") ||
+    if (has_trait( trait_PARAIMMUNE ) && (has_effect("dermatik") || has_effect("tapeworm") ||
           has_effect("bloodworms") || has_effect("brainworm") || has_effect("paincysts")) ) {
         remove_effect("dermatik");
         remove_effect("tapeworm");
@@ -5496,11 +5752,11 @@ void player::process_effects() {
         remove_effect("paincysts");
         add_msg_if_player(m_good, _("Something writhes and inside of you as it dies."));
     }
-    if (has_trait("EATHEALTH") && has_effect("tapeworm")) {
+    if (has_trait( trait_EATHEALTH ) && has_effect("tapeworm")) {
         remove_effect("tapeworm");
         add_msg_if_player(m_good, _("Your bowels gurgle as something inside them dies."));
     }
-    if (has_trait("INFIMMUNE") && (has_effect("bite") || has_effect("infected") ||
+    if (has_trait( trait_INFIMMUNE ) && (has_effect("bite") || has_effect("infected") ||
           has_effect("recover")) ) {
         remove_effect("bite");
         remove_effect("infected");
@@ -5615,13 +5871,13 @@ void player::process_effects() {
             if (val != 0) {
                 mod = 1;
                 if (it.get_sizing("PAIN")) {
-                    if (has_trait("FAT")) {
+                    if (has_trait( trait_FAT )) {
                         mod *= 1.5;
                     }
-                    if (has_trait("LARGE") || has_trait("LARGE_OK")) {
+                    if (has_trait( trait_LARGE ) || has_trait( trait_LARGE_OK )) {
                         mod *= 2;
                     }
-                    if (has_trait("HUGE") || has_trait("HUGE_OK")) {
+                    if (has_trait( trait_HUGE ) || has_trait( trait_HUGE_OK )) {
                         mod *= 3;
                     }
                 }
@@ -5639,13 +5895,13 @@ void player::process_effects() {
             if (val != 0) {
                 mod = 1;
                 if (it.get_sizing("HURT")) {
-                    if (has_trait("FAT")) {
+                    if (has_trait( trait_FAT )) {
                         mod *= 1.5;
                     }
-                    if (has_trait("LARGE") || has_trait("LARGE_OK")) {
+                    if (has_trait( trait_LARGE ) || has_trait( trait_LARGE_OK )) {
                         mod *= 2;
                     }
-                    if (has_trait("HUGE") || has_trait("HUGE_OK")) {
+                    if (has_trait( trait_HUGE ) || has_trait( trait_HUGE_OK )) {
                         mod *= 3;
                     }
                 }
@@ -5716,7 +5972,7 @@ void player::hardcoded_effects(effect &it)
     bool msg_trig = one_in(400);
     if (id == "onfire") {
         // TODO: this should be determined by material properties
-        if (!has_trait("M_SKIN2")) {
+        if (!has_trait( trait_M_SKIN2 )) {
             hurtall(3, nullptr);
         }
         for (size_t i = 0; i < worn.size(); i++) {
@@ -5733,7 +5989,7 @@ void player::hardcoded_effects(effect &it)
         }
     } else if (id == "spores") {
         // Equivalent to X in 150000 + health * 100
-        if ((!has_trait("M_IMMUNE")) && (one_in(100) && x_in_y(intense, 150 + get_healthy() / 10)) ) {
+        if ((!has_trait( trait_M_IMMUNE )) && (one_in(100) && x_in_y(intense, 150 + get_healthy() / 10)) ) {
             add_effect("fungus", 1, num_bp, true);
         }
     } else if (id == "fungus") {
@@ -6510,7 +6766,7 @@ void player::hardcoded_effects(effect &it)
             }
         }
         if (one_in(10000)) {
-            if (!has_trait("M_IMMUNE")) {
+            if (!has_trait( trait_M_IMMUNE )) {
                 add_effect("fungus", 1, num_bp, true);
             } else {
                 add_msg_if_player(m_info, _("We have many colonists awaiting passage."));
@@ -6663,7 +6919,7 @@ void player::hardcoded_effects(effect &it)
             if (has_effect("recover")) {
                 recover_factor -= get_effect_dur("recover") / 600;
             }
-            if (has_trait("INFRESIST")) {
+            if (has_trait( trait_INFRESIST )) {
                 recover_factor += 1000;
             }
             recover_factor += get_healthy() / 10;
@@ -6695,7 +6951,7 @@ void player::hardcoded_effects(effect &it)
             if (has_effect("recover")) {
                 recover_factor -= get_effect_dur("recover") / 600;
             }
-            if (has_trait("INFRESIST")) {
+            if (has_trait( trait_INFRESIST )) {
                 recover_factor += 1000;
             }
             recover_factor += get_healthy() / 10;
@@ -6739,7 +6995,7 @@ void player::hardcoded_effects(effect &it)
                     add_msg_if_player(_("You use your %s to keep warm."), item_name.c_str());
                 }
             }
-            if (has_trait("HIBERNATE") && (hunger < -60)) {
+            if (has_trait( trait_HIBERNATE ) && (hunger < -60)) {
                 add_memorial_log(pgettext("memorial_male", "Entered hibernation."),
                                    pgettext("memorial_female", "Entered hibernation."));
                 // 10 days' worth of round-the-clock Snooze.  Cata seasons default to 14 days.
@@ -6765,7 +7021,7 @@ void player::hardcoded_effects(effect &it)
         // a little, and came out of it well into Parched.  Hibernating shouldn't endanger your
         // life like that--but since there's much less fluid reserve than food reserve,
         // simply using the same numbers won't work.
-        if((int(calendar::turn) % 350 == 0) && has_trait("HIBERNATE") && !(hunger > -60) && !(thirst >= 80)) {
+        if((int(calendar::turn) % 350 == 0) && has_trait( trait_HIBERNATE ) && !(hunger > -60) && !(thirst >= 80)) {
             int recovery_chance;
             // Hibernators' metabolism slows down: you heal and recover Fatigue much more slowly.
             // Accelerated recovery capped to 2x over 2 hours...well, it was ;-P
@@ -6780,16 +7036,16 @@ void player::hardcoded_effects(effect &it)
                 fatigue -= 1 + one_in(recovery_chance);
             }
             int heal_chance = get_healthy() / 4;
-            if ((has_trait("FLIMSY") && x_in_y(3, 4)) || (has_trait("FLIMSY2") && one_in(2)) ||
-                  (has_trait("FLIMSY3") && one_in(4)) ||
-                  (!has_trait("FLIMSY") && !has_trait("FLIMSY2") && !has_trait("FLIMSY3"))) {
-                if (has_trait("FASTHEALER") || has_trait("MET_RAT")) {
+            if ((has_trait( trait_FLIMSY ) && x_in_y(3, 4)) || (has_trait( trait_FLIMSY2 ) && one_in(2)) ||
+                  (has_trait( trait_FLIMSY3 ) && one_in(4)) ||
+                  (!has_trait( trait_FLIMSY ) && !has_trait( trait_FLIMSY2 ) && !has_trait( trait_FLIMSY3 ))) {
+                if (has_trait( trait_FASTHEALER ) || has_trait( trait_MET_RAT )) {
                     heal_chance += 100;
-                } else if (has_trait("FASTHEALER2")) {
+                } else if (has_trait( trait_FASTHEALER2 )) {
                     heal_chance += 150;
-                } else if (has_trait("REGEN")) {
+                } else if (has_trait( trait_REGEN )) {
                     heal_chance += 200;
-                } else if (has_trait("SLOWHEALER")) {
+                } else if (has_trait( trait_SLOWHEALER )) {
                     heal_chance += 13;
                 } else {
                     heal_chance += 25;
@@ -6827,7 +7083,7 @@ void player::hardcoded_effects(effect &it)
 
                 // You fatigue & recover faster with Sleepy
                 // Very Sleepy, you just fatigue faster
-                if (has_trait("SLEEPY") || has_trait("MET_RAT")) {
+                if (has_trait( trait_SLEEPY ) || has_trait( trait_MET_RAT )) {
                     const int roll = (one_in(recovery_chance) ? 1.0 : 0.0);
                     delta += (1.0 + roll) / 2.0;
                 }
@@ -6835,7 +7091,7 @@ void player::hardcoded_effects(effect &it)
                 // Tireless folks recover fatigue really fast
                 // as well as gaining it really slowly
                 // (Doesn't speed healing any, though...)
-                if (has_trait("WAKEFUL3")) {
+                if (has_trait( trait_WAKEFUL3 )) {
                     const int roll = (one_in(recovery_chance) ? 1.0 : 0.0);
                     delta += (2.0 + roll) / 2.0;
                 }
@@ -6844,16 +7100,16 @@ void player::hardcoded_effects(effect &it)
             }
 
             int heal_chance = get_healthy() / 4;
-            if ((has_trait("FLIMSY") && x_in_y(3, 4)) || (has_trait("FLIMSY2") && one_in(2)) ||
-                  (has_trait("FLIMSY3") && one_in(4)) ||
-                  (!has_trait("FLIMSY") && !has_trait("FLIMSY2") && !has_trait("FLIMSY3"))) {
-                if (has_trait("FASTHEALER") || has_trait("MET_RAT")) {
+            if ((has_trait( trait_FLIMSY ) && x_in_y(3, 4)) || (has_trait( trait_FLIMSY2 ) && one_in(2)) ||
+                  (has_trait( trait_FLIMSY3 ) && one_in(4)) ||
+                  (!has_trait( trait_FLIMSY ) && !has_trait( trait_FLIMSY2 ) && !has_trait( trait_FLIMSY3 ))) {
+                if (has_trait( trait_FASTHEALER ) || has_trait( trait_MET_RAT )) {
                     heal_chance += 100;
-                } else if (has_trait("FASTHEALER2")) {
+                } else if (has_trait( trait_FASTHEALER2 )) {
                     heal_chance += 150;
-                } else if (has_trait("REGEN")) {
+                } else if (has_trait( trait_REGEN )) {
                     heal_chance += 200;
-                } else if (has_trait("SLOWHEALER")) {
+                } else if (has_trait( trait_SLOWHEALER )) {
                     heal_chance += 13;
                 } else {
                     heal_chance += 25;
@@ -6889,7 +7145,7 @@ void player::hardcoded_effects(effect &it)
             thirst--;
         }
 
-        if (int(calendar::turn) % 100 == 0 && has_trait("CHLOROMORPH") &&
+        if (int(calendar::turn) % 100 == 0 && has_trait( trait_CHLOROMORPH ) &&
         g->is_in_sunlight(posx(), posy()) ) {
             // Hunger and thirst fall before your Chloromorphic physiology!
             if (hunger >= -30) {
@@ -6926,7 +7182,7 @@ void player::hardcoded_effects(effect &it)
                     add_msg_if_player( "%s", dream.c_str() );
                 }
                 // Mycus folks upgrade in their sleep.
-                if (has_trait("THRESH_MYCUS")) {
+                if (has_trait( trait_THRESH_MYCUS )) {
                     if (one_in(8)) {
                         mutate_category("MUTCAT_MYCUS");
                         hunger += 10;
@@ -6940,7 +7196,7 @@ void player::hardcoded_effects(effect &it)
         bool woke_up = false;
         int tirednessVal = rng(5, 200) + rng(0, abs(fatigue * 2 * 5));
         if (!has_effect("blind") && !worn_with_flag("BLIND")) {
-            if (has_trait("HEAVYSLEEPER2") && !has_trait("HIBERNATE")) {
+            if (has_trait( trait_HEAVYSLEEPER2 ) && !has_trait( trait_HIBERNATE )) {
                 // So you can too sleep through noon
                 if ((tirednessVal * 1.25) < g->light_level() && (fatigue < 10 || one_in(fatigue / 2))) {
                     add_msg_if_player(_("It's too bright to sleep."));
@@ -6949,7 +7205,7 @@ void player::hardcoded_effects(effect &it)
                     woke_up = true;
                 }
              // Ursine hibernators would likely do so indoors.  Plants, though, might be in the sun.
-            } else if (has_trait("HIBERNATE")) {
+            } else if (has_trait( trait_HIBERNATE )) {
                 if ((tirednessVal * 5) < g->light_level() && (fatigue < 10 || one_in(fatigue / 2))) {
                     add_msg_if_player(_("It's too bright to sleep."));
                     // Set ourselves up for removal
@@ -7006,10 +7262,10 @@ void player::hardcoded_effects(effect &it)
                     // It's much harder to ignore an alarm inside your own skull,
                     // so this uses an effective volume of 20.
                     const int volume = 20;
-                    if ( (!(has_trait("HEAVYSLEEPER") || has_trait("HEAVYSLEEPER2")) &&
+                    if ( (!(has_trait( trait_HEAVYSLEEPER ) || has_trait( trait_HEAVYSLEEPER2 )) &&
                           dice(2, 15) < volume) ||
-                          (has_trait("HEAVYSLEEPER") && dice(3, 15) < volume) ||
-                          (has_trait("HEAVYSLEEPER2") && dice(6, 15) < volume) ) {
+                          (has_trait( trait_HEAVYSLEEPER ) && dice(3, 15) < volume) ||
+                          (has_trait( trait_HEAVYSLEEPER2 ) && dice(6, 15) < volume) ) {
                         wake_up();
                         add_msg_if_player(_("Your internal chronometer wakes you up."));
                     } else {
@@ -7036,16 +7292,16 @@ double player::vomit_mod()
     if (has_effect("weed_high")) {
         mod *= .1;
     }
-    if (has_trait("STRONGSTOMACH")) {
+    if (has_trait( trait_STRONGSTOMACH )) {
         mod *= .5;
     }
-    if (has_trait("WEAKSTOMACH")) {
+    if (has_trait( trait_WEAKSTOMACH )) {
         mod *= 2;
     }
-    if (has_trait("NAUSEA")) {
+    if (has_trait( trait_NAUSEA )) {
         mod *= 3;
     }
-    if (has_trait("VOMITOUS")) {
+    if (has_trait( trait_VOMITOUS )) {
         mod *= 3;
     }
 
@@ -7104,7 +7360,7 @@ void player::suffer()
     }
 
     if (underwater) {
-        if (!has_trait("GILLS") && !has_trait("GILLS_CEPH")) {
+        if (!has_trait( trait_GILLS ) && !has_trait( trait_GILLS_CEPH )) {
             oxygen--;
         }
         if (oxygen < 12 && worn_with_flag("REBREATHER")) {
@@ -7127,7 +7383,7 @@ void player::suffer()
     }
 
     double shoe_factor = footwear_factor();
-    if( has_trait("ROOTS3") && g->m.has_flag("DIGGABLE", posx(), posy()) && !shoe_factor) {
+    if( has_trait( trait_ROOTS3 ) && g->m.has_flag("DIGGABLE", posx(), posy()) && !shoe_factor) {
         if (one_in(100)) {
             add_msg(m_good, _("This soil is delicious!"));
             if (hunger > -20) {
@@ -7193,7 +7449,7 @@ void player::suffer()
             }
         }
         if (weight_carried() > 4 * weight_capacity()) {
-            if (has_trait("LEG_TENT_BRACE")){
+            if (has_trait( trait_LEG_TENT_BRACE )){
                 add_msg_if_player(m_bad, _("Your tentacles buckle under the weight!"));
             }
             if (has_effect("downed")) {
@@ -7203,10 +7459,10 @@ void player::suffer()
             }
         }
         int timer = -3600;
-        if (has_trait("ADDICTIVE")) {
+        if (has_trait( trait_ADDICTIVE )) {
             timer = -4000;
         }
-        if (has_trait("NONADDICTIVE")) {
+        if (has_trait( trait_NONADDICTIVE )) {
             timer = -3200;
         }
         for (size_t i = 0; i < addictions.size(); i++) {
@@ -7235,8 +7491,8 @@ void player::suffer()
                 }
             }
         }
-        if (has_trait("CHEMIMBALANCE")) {
-            if (one_in(3600) && (!(has_trait("NOPAIN")))) {
+        if (has_trait( trait_CHEMIMBALANCE )) {
+            if (one_in(3600) && (!(has_trait( trait_NOPAIN )))) {
                 add_msg(m_bad, _("You suddenly feel sharp pain for no reason."));
                 mod_pain( 3 * rng(1, 3) );
             }
@@ -7244,7 +7500,7 @@ void player::suffer()
                 int pkilladd = 5 * rng(-1, 2);
                 if (pkilladd > 0) {
                     add_msg(m_bad, _("You suddenly feel numb."));
-                } else if ((pkilladd < 0) && (!(has_trait("NOPAIN")))) {
+                } else if ((pkilladd < 0) && (!(has_trait( trait_NOPAIN )))) {
                     add_msg(m_bad, _("You suddenly ache."));
                 }
                 pkill += pkilladd;
@@ -7304,7 +7560,7 @@ void player::suffer()
                 }
             }
         }
-        if ((has_trait("SCHIZOPHRENIC") || has_artifact_with(AEP_SCHIZO)) &&
+        if ((has_trait( trait_SCHIZOPHRENIC ) || has_artifact_with(AEP_SCHIZO)) &&
             one_in(2400)) { // Every 4 hours or so
             monster phantasm;
             int i;
@@ -7359,7 +7615,7 @@ void player::suffer()
                     break;
             }
         }
-        if (has_trait("JITTERY") && !has_effect("shakes")) {
+        if (has_trait( trait_JITTERY ) && !has_effect("shakes")) {
             if (stim > 50 && one_in(300 - stim)) {
                 add_effect("shakes", 300 + stim);
             } else if (hunger > 80 && one_in(500 - hunger)) {
@@ -7367,7 +7623,7 @@ void player::suffer()
             }
         }
 
-        if (has_trait("MOODSWINGS") && one_in(3600)) {
+        if (has_trait( trait_MOODSWINGS ) && one_in(3600)) {
             if (rng(1, 20) > 9) { // 55% chance
                 add_morale(MORALE_MOODSWING, -100, -500);
             } else {  // 45% chance
@@ -7375,27 +7631,27 @@ void player::suffer()
             }
         }
 
-        if (has_trait("VOMITOUS") && one_in(4200)) {
+        if (has_trait( trait_VOMITOUS ) && one_in(4200)) {
             vomit();
         }
-        if (has_trait("SHOUT1") && one_in(3600)) {
+        if (has_trait( trait_SHOUT1 ) && one_in(3600)) {
             sounds::sound(posx(), posy(), 10 + 2 * str_cur, _("You shout loudly!"));
         }
-        if (has_trait("SHOUT2") && one_in(2400)) {
+        if (has_trait( trait_SHOUT2 ) && one_in(2400)) {
             sounds::sound(posx(), posy(), 15 + 3 * str_cur, _("You scream loudly!"));
         }
-        if (has_trait("SHOUT3") && one_in(1800)) {
+        if (has_trait( trait_SHOUT3 ) && one_in(1800)) {
             sounds::sound(posx(), posy(), 20 + 4 * str_cur, _("You let out a piercing howl!"));
         }
-        if (has_trait("M_SPORES") && one_in(2400)) {
+        if (has_trait( trait_M_SPORES ) && one_in(2400)) {
             spores();
         }
-        if (has_trait("M_BLOSSOMS") && one_in(1800)) {
+        if (has_trait( trait_M_BLOSSOMS ) && one_in(1800)) {
             blossoms();
         }
     } // Done with while-awake-only effects
 
-    if (has_trait("ASTHMA") && one_in(3600 - stim * 50)) {
+    if (has_trait( trait_ASTHMA ) && one_in(3600 - stim * 50)) {
         bool auto_use = has_charges("inhaler", 1);
         if (underwater) {
             oxygen = int(oxygen / 2);
@@ -7429,23 +7685,23 @@ void player::suffer()
         }
     }
 
-    if (has_trait("LEAVES") && g->is_in_sunlight(posx(), posy()) && one_in(600)) {
+    if (has_trait( trait_LEAVES ) && g->is_in_sunlight(posx(), posy()) && one_in(600)) {
         hunger--;
     }
 
     if (pain > 0) {
-        if (has_trait("PAINREC1") && one_in(600)) {
+        if (has_trait( trait_PAINREC1 ) && one_in(600)) {
             pain--;
         }
-        if (has_trait("PAINREC2") && one_in(300)) {
+        if (has_trait( trait_PAINREC2 ) && one_in(300)) {
             pain--;
         }
-        if (has_trait("PAINREC3") && one_in(150)) {
+        if (has_trait( trait_PAINREC3 ) && one_in(150)) {
             pain--;
         }
     }
 
-    if( (has_trait("ALBINO") || has_effect("datura")) &&
+    if( (has_trait( trait_ALBINO ) || has_effect("datura")) &&
         g->is_in_sunlight(posx(), posy()) && one_in(10) ) {
         // Umbrellas and rain gear can also keep the sun off!
         // (No, really, I know someone who uses an umbrella when it's sunny out.)
@@ -7461,7 +7717,7 @@ void player::suffer()
         }
     }
 
-    if (has_trait("SUNBURN") && g->is_in_sunlight(posx(), posy()) && one_in(10)) {
+    if (has_trait( trait_SUNBURN ) && g->is_in_sunlight(posx(), posy()) && one_in(10)) {
         if (!((worn_with_flag("RAINPROOF")) || (weapon.has_flag("RAIN_PROTECT"))) ) {
         add_msg(m_bad, _("The sunlight burns your skin!"));
         if (in_sleep_state()) {
@@ -7472,7 +7728,7 @@ void player::suffer()
         }
     }
 
-    if ((has_trait("TROGLO") || has_trait("TROGLO2")) &&
+    if ((has_trait( trait_TROGLO ) || has_trait( trait_TROGLO2 )) &&
         g->is_in_sunlight(posx(), posy()) && g->weather == WEATHER_SUNNY) {
         mod_str_bonus(-1);
         mod_dex_bonus(-1);
@@ -7480,14 +7736,14 @@ void player::suffer()
         mod_int_bonus(-1);
         mod_per_bonus(-1);
     }
-    if (has_trait("TROGLO2") && g->is_in_sunlight(posx(), posy())) {
+    if (has_trait( trait_TROGLO2 ) && g->is_in_sunlight(posx(), posy())) {
         mod_str_bonus(-1);
         mod_dex_bonus(-1);
         add_miss_reason(_("The sunlight distracts you."), 1);
         mod_int_bonus(-1);
         mod_per_bonus(-1);
     }
-    if (has_trait("TROGLO3") && g->is_in_sunlight(posx(), posy())) {
+    if (has_trait( trait_TROGLO3 ) && g->is_in_sunlight(posx(), posy())) {
         mod_str_bonus(-4);
         mod_dex_bonus(-4);
         add_miss_reason(_("You can't stand the sunlight!"), 4);
@@ -7495,16 +7751,16 @@ void player::suffer()
         mod_per_bonus(-4);
     }
 
-    if (has_trait("SORES")) {
+    if (has_trait( trait_SORES )) {
         for (int i = bp_head; i < num_bp; i++) {
-            if ((pain < 5 + 4 * abs(encumb(body_part(i)))) && (!(has_trait("NOPAIN")))) {
+            if ((pain < 5 + 4 * abs(encumb(body_part(i)))) && (!(has_trait( trait_NOPAIN )))) {
                 pain = 0;
                 mod_pain( 5 + 4 * abs(encumb(body_part(i))) );
             }
         }
     }
 
-    if (has_trait("SLIMY") && !in_vehicle) {
+    if (has_trait( trait_SLIMY ) && !in_vehicle) {
         g->m.add_field(posx(), posy(), fd_slime, 1);
     }
         //Web Weavers...weave web
@@ -7513,7 +7769,7 @@ void player::suffer()
 
      }
 
-    if (has_trait("VISCOUS") && !in_vehicle) {
+    if (has_trait( trait_VISCOUS ) && !in_vehicle) {
         if (one_in(3)){
             g->m.add_field(posx(), posy(), fd_slime, 1);
         }
@@ -7524,7 +7780,7 @@ void player::suffer()
 
     // Blind/Deaf for brief periods about once an hour,
     // and visuals about once every 30 min.
-    if (has_trait("PER_SLIME")) {
+    if (has_trait( trait_PER_SLIME )) {
         if (one_in(600) && !has_effect("deaf")) {
             add_msg(m_bad, _("Suddenly, you can't hear anything!"));
             add_effect("deaf", 20 * rng (2, 6)) ;
@@ -7541,11 +7797,11 @@ void player::suffer()
         }
     }
 
-    if (has_trait("WEB_SPINNER") && !in_vehicle && one_in(3)) {
+    if (has_trait( trait_WEB_SPINNER ) && !in_vehicle && one_in(3)) {
         g->m.add_field(posx(), posy(), fd_web, 1); //this adds density to if its not already there.
     }
 
-    if( has_trait("RADIOGENIC") && int(calendar::turn) % MINUTES(30) == 0 && radiation > 0 ) {
+    if( has_trait( trait_RADIOGENIC ) && int(calendar::turn) % MINUTES(30) == 0 && radiation > 0 ) {
         // At 100 irradiation, twice as fast as REGEN
         if( x_in_y( radiation, 100 ) ) {
             healall( 1 );
@@ -7554,11 +7810,11 @@ void player::suffer()
     }
 
     int rad_mut = 0;
-    if (has_trait("RADIOACTIVE3") ) {
+    if (has_trait( trait_RADIOACTIVE3 ) ) {
         rad_mut = 3;
-    } else if (has_trait("RADIOACTIVE2")) {
+    } else if (has_trait( trait_RADIOACTIVE2 )) {
         rad_mut = 2;
-    } else if (has_trait("RADIOACTIVE1")) {
+    } else if (has_trait( trait_RADIOACTIVE1 )) {
         rad_mut = 1;
     }
     if( rad_mut > 0 ) {
@@ -7569,10 +7825,10 @@ void player::suffer()
         }
     }
 
-    if (has_trait("UNSTABLE") && one_in(28800)) { // Average once per 2 days
+    if (has_trait( trait_UNSTABLE ) && one_in(28800)) { // Average once per 2 days
         mutate();
     }
-    if (has_trait("CHAOTIC") && one_in(7200)) { // Should be once every 12 hours
+    if (has_trait( trait_CHAOTIC ) && one_in(7200)) { // Should be once every 12 hours
         mutate();
     }
     if (has_artifact_with(AEP_MUTAGENIC) && one_in(28800)) {
@@ -7746,7 +8002,7 @@ void player::mend()
         if(broken) {
             double mending_odds = 200.0; // 2 weeks, on average. (~20160 minutes / 100 minutes)
             double healing_factor = 1.0;
-            if (has_trait("REGEN_LIZ")) {
+            if (has_trait( trait_REGEN_LIZ )) {
                 healing_factor = 20.0;
             }
             // Studies have shown that alcohol and tobacco use delay fracture healing time
@@ -7780,13 +8036,13 @@ void player::mend()
             }
 
             // Mutagenic healing factor!
-            if(has_trait("REGEN")) {
+            if(has_trait( trait_REGEN )) {
                 healing_factor *= 16.0;
-            } else if (has_trait("FASTHEALER2")) {
+            } else if (has_trait( trait_FASTHEALER2 )) {
                 healing_factor *= 4.0;
-            } else if (has_trait("FASTHEALER")) {
+            } else if (has_trait( trait_FASTHEALER )) {
                 healing_factor *= 2.0;
-            } else if (has_trait("SLOWHEALER")) {
+            } else if (has_trait( trait_SLOWHEALER )) {
                 healing_factor *= 0.5;
             }
 
@@ -7796,7 +8052,7 @@ void player::mend()
                 case hp_arm_r:
                     part = bp_arm_r;
                     mended = is_wearing_on_bp("arm_splint", bp_arm_r) && x_in_y(healing_factor, mending_odds);
-                    if (mended == false && has_trait("REGEN_LIZ")) {
+                    if (mended == false && has_trait( trait_REGEN_LIZ )) {
                         healing_factor *= 0.2; // Splints aren't *strictly* necessary for your anatomy
                         mended = x_in_y(healing_factor, mending_odds);
                     }
@@ -7804,7 +8060,7 @@ void player::mend()
                 case hp_arm_l:
                     part = bp_arm_l;
                     mended = is_wearing_on_bp("arm_splint", bp_arm_l) && x_in_y(healing_factor, mending_odds);
-                    if (mended == false && has_trait("REGEN_LIZ")) {
+                    if (mended == false && has_trait( trait_REGEN_LIZ )) {
                         healing_factor *= 0.2; // But without them, you're looking at a much longer recovery.
                         mended = x_in_y(healing_factor, mending_odds);
                     }
@@ -7812,7 +8068,7 @@ void player::mend()
                 case hp_leg_r:
                     part = bp_leg_r;
                     mended = is_wearing_on_bp("leg_splint", bp_leg_r) && x_in_y(healing_factor, mending_odds);
-                    if (mended == false && has_trait("REGEN_LIZ")) {
+                    if (mended == false && has_trait( trait_REGEN_LIZ )) {
                         healing_factor *= 0.2;
                         mended = x_in_y(healing_factor, mending_odds);
                     }
@@ -7820,7 +8076,7 @@ void player::mend()
                 case hp_leg_l:
                     part = bp_leg_l;
                     mended = is_wearing_on_bp("leg_splint", bp_leg_l) && x_in_y(healing_factor, mending_odds);
-                    if (mended == false && has_trait("REGEN_LIZ")) {
+                    if (mended == false && has_trait( trait_REGEN_LIZ )) {
                         healing_factor *= 0.2;
                         mended = x_in_y(healing_factor, mending_odds);
                     }
@@ -7879,7 +8135,7 @@ void player::vomit()
 void player::drench(int saturation, int flags)
 {
     // OK, water gets in your AEP suit or whatever.  It wasn't built to keep you dry.
-    if ( (has_trait("DEBUG_NOTEMP")) || (has_active_mutation("SHELL2")) ||
+    if ( (has_trait( trait_DEBUG_NOTEMP )) || (has_active_mutation("SHELL2")) ||
       ((is_waterproof(flags)) && (!(g->m.has_flag(TFLAG_DEEP_WATER, posx(), posy())))) ) {
         return;
     }
@@ -7964,19 +8220,19 @@ void player::drench(int saturation, int flags)
     int dur = 60;
     int d_start = 30;
     if (morale_cap < 0) {
-        if (has_trait("LIGHTFUR") || has_trait("FUR") || has_trait("FELINE_FUR") ||
-          has_trait("LUPINE_FUR") || has_trait("CHITIN_FUR") || has_trait("CHITIN_FUR2") ||
-          has_trait("CHITIN_FUR3")) {
+        if (has_trait( trait_LIGHTFUR ) || has_trait( trait_FUR ) || has_trait( trait_FELINE_FUR ) ||
+          has_trait( trait_LUPINE_FUR ) || has_trait( trait_CHITIN_FUR ) || has_trait( trait_CHITIN_FUR2 ) ||
+          has_trait( trait_CHITIN_FUR3 )) {
             dur /= 5;
             d_start /= 5;
         }
         // Shaggy fur holds water longer.  :-/
-        if (has_trait("URSINE_FUR")) {
+        if (has_trait( trait_URSINE_FUR )) {
             dur /= 3;
             d_start /= 3;
         }
     } else {
-        if (has_trait("SLIMY")) {
+        if (has_trait( trait_SLIMY )) {
             dur *= 1.2;
             d_start *= 1.2;
         }
@@ -8022,15 +8278,15 @@ void player::update_body_wetness()
     * Mutations and weather can affect the duration of the player being wet.
     */
     int delay = 10;
-    if( has_trait("LIGHTFUR") || has_trait("FUR") || has_trait("FELINE_FUR") ||
-        has_trait("LUPINE_FUR") || has_trait("CHITIN_FUR") || has_trait("CHITIN_FUR2") ||
-        has_trait("CHITIN_FUR3")) {
+    if( has_trait( trait_LIGHTFUR ) || has_trait( trait_FUR ) || has_trait( trait_FELINE_FUR ) ||
+        has_trait( trait_LUPINE_FUR ) || has_trait( trait_CHITIN_FUR ) || has_trait( trait_CHITIN_FUR2 ) ||
+        has_trait( trait_CHITIN_FUR3 )) {
         delay += 2;
     }
-    if (has_trait("URSINE_FUR")) {
+    if (has_trait( trait_URSINE_FUR )) {
         delay += 5;
     }
-    if (has_trait("SLIMY")) {
+    if (has_trait( trait_SLIMY )) {
         delay -= 5;
     }
     if (g->weather == WEATHER_SUNNY) {
@@ -8078,7 +8334,7 @@ int player::net_morale(morale_point effect)
 
     // Optimistic characters focus on the good things in life,
     // and downplay the bad things.
-    if (has_trait("OPTIMISTIC"))
+    if (has_trait( trait_OPTIMISTIC ))
     {
         if (bonus >= 0)
         {
@@ -8092,7 +8348,7 @@ int player::net_morale(morale_point effect)
 
      // Again, those grouchy Bad-Tempered folks always focus on the negative.
      // They can't handle positive things as well.  They're No Fun.  D:
-    if (has_trait("BADTEMPER"))
+    if (has_trait( trait_BADTEMPER ))
     {
         if (bonus < 0)
         {
@@ -9015,17 +9271,17 @@ bool player::eat(item *eaten, it_comest *comest)
         return false;
     }
     // For all those folks who loved eating marloss berries.  D:< mwuhahaha
-    if (has_trait("M_DEPENDENT") && (eaten->type->id != "mycus_fruit")) {
+    if (has_trait( trait_M_DEPENDENT ) && (eaten->type->id != "mycus_fruit")) {
         add_msg_if_player(m_info, _("We can't eat that.  It's not right for us."));
         return false;
     }
     // Here's why PROBOSCIS is such a negative trait.
-    if ( (has_trait("PROBOSCIS")) && (comest->comesttype == "FOOD" ||
+    if ( (has_trait( trait_PROBOSCIS )) && (comest->comesttype == "FOOD" ||
         eaten->has_flag("USE_EAT_VERB")) ) {
         add_msg_if_player(m_info,  _("Ugh, you can't drink that!"));
         return false;
     }
-    bool overeating = (!has_trait("GOURMAND") && hunger < 0 &&
+    bool overeating = (!has_trait( trait_GOURMAND ) && hunger < 0 &&
                        nutrition_for(comest) >= 5);
     bool hiberfood = (has_active_mutation("HIBERNATE") && (hunger > -60 && thirst > -60 ));
     eaten->calc_rot(pos()); // check if it's rotten before eating!
@@ -9033,10 +9289,10 @@ bool player::eat(item *eaten, it_comest *comest)
 
     last_item = itype_id(eaten->type->id);
 
-    if (overeating && !has_trait("HIBERNATE") && !has_trait("EATHEALTH") && !is_npc() &&
-        !has_trait("SLIMESPAWNER") && !query_yn(_("You're full.  Force yourself to eat?"))) {
+    if (overeating && !has_trait( trait_HIBERNATE ) && !has_trait( trait_EATHEALTH ) && !is_npc() &&
+        !has_trait( trait_SLIMESPAWNER ) && !query_yn(_("You're full.  Force yourself to eat?"))) {
         return false;
-    } else if (has_trait("GOURMAND") && hunger < 0 && nutrition_for(comest) >= 5) {
+    } else if (has_trait( trait_GOURMAND ) && hunger < 0 && nutrition_for(comest) >= 5) {
         if (!query_yn(_("You're fed.  Try to pack more in anyway?"))) {
             return false;
         }
@@ -9054,53 +9310,53 @@ bool player::eat(item *eaten, it_comest *comest)
                       add_msg(_("You've begun stockpiling calories and liquid for hibernation.  You get the feeling that you should prepare for bed, just in case, but...you're hungry again, and you could eat a whole week's worth of food RIGHT NOW."));
       }
     }
-    if (has_trait("CARNIVORE") && (eaten->made_of("veggy") || eaten->made_of("fruit") || eaten->made_of("wheat")) &&
+    if (has_trait( trait_CARNIVORE ) && (eaten->made_of("veggy") || eaten->made_of("fruit") || eaten->made_of("wheat")) &&
       !(eaten->made_of("flesh") ||eaten->made_of("hflesh") || eaten->made_of("iflesh") || eaten->made_of("milk") ||
       eaten->made_of("egg")) && nutrition_for(comest) > 0) {
         add_msg_if_player(m_info, _("Eww.  Inedible plant stuff!"));
         return false;
     }
-    if ((!has_trait("SAPIOVORE") && !has_trait("CANNIBAL") && !has_trait("PSYCHOPATH")) && eaten->made_of("hflesh")&&
+    if ((!has_trait( trait_SAPIOVORE ) && !has_trait( trait_CANNIBAL ) && !has_trait( trait_PSYCHOPATH )) && eaten->made_of("hflesh")&&
         !is_npc() && !query_yn(_("The thought of eating that makes you feel sick.  Really do it?"))) {
         return false;
     }
-    if ((!has_trait("SAPIOVORE") && has_trait("CANNIBAL") && !has_trait("PSYCHOPATH") && !has_trait("SPIRITUAL")) && eaten->made_of("hflesh")&& !is_npc() &&
+    if ((!has_trait( trait_SAPIOVORE ) && has_trait( trait_CANNIBAL ) && !has_trait( trait_PSYCHOPATH ) && !has_trait( trait_SPIRITUAL )) && eaten->made_of("hflesh")&& !is_npc() &&
         !query_yn(_("The thought of eating that makes you feel both guilty and excited.  Really do it?"))) {
         return false;
     }
 
-    if ((!has_trait("SAPIOVORE") && has_trait("CANNIBAL") && !has_trait("PSYCHOPATH") && has_trait("SPIRITUAL")) &&
+    if ((!has_trait( trait_SAPIOVORE ) && has_trait( trait_CANNIBAL ) && !has_trait( trait_PSYCHOPATH ) && has_trait( trait_SPIRITUAL )) &&
          eaten->made_of("hflesh")&& !is_npc() &&
         !query_yn(_("Cannibalism is such a universal taboo.  Will you break it?"))) {
         return false;
     }
 
-    if (has_trait("VEGETARIAN") && eaten->made_of("flesh") && !is_npc() &&
+    if (has_trait( trait_VEGETARIAN ) && eaten->made_of("flesh") && !is_npc() &&
         !query_yn(_("Really eat that %s?  Your stomach won't be happy."), eaten->tname().c_str())) {
         return false;
     }
-    if (has_trait("MEATARIAN") && eaten->made_of("veggy") && !is_npc() &&
+    if (has_trait( trait_MEATARIAN ) && eaten->made_of("veggy") && !is_npc() &&
         !query_yn(_("Really eat that %s?  Your stomach won't be happy."), eaten->tname().c_str())) {
         return false;
     }
-    if (has_trait("LACTOSE") && eaten->made_of("milk") && (!has_bionic("bio_digestion")) && !is_npc() &&
+    if (has_trait( trait_LACTOSE ) && eaten->made_of("milk") && (!has_bionic("bio_digestion")) && !is_npc() &&
         !query_yn(_("Really eat that %s?  Your stomach won't be happy."), eaten->tname().c_str())) {
         return false;
     }
-    if (has_trait("ANTIFRUIT") && eaten->made_of("fruit") && !is_npc() &&
+    if (has_trait( trait_ANTIFRUIT ) && eaten->made_of("fruit") && !is_npc() &&
         !query_yn(_("Really eat that %s?  Your stomach won't be happy."), eaten->tname().c_str())) {
         return false;
     }
-    if (has_trait("ANTIJUNK") && eaten->made_of("junk") && (!has_bionic("bio_digestion")) && !is_npc() &&
+    if (has_trait( trait_ANTIJUNK ) && eaten->made_of("junk") && (!has_bionic("bio_digestion")) && !is_npc() &&
         !query_yn(_("Really eat that %s?  Your stomach won't be happy."), eaten->tname().c_str())) {
         return false;
     }
-    if (has_trait("ANTIWHEAT") && eaten->made_of("wheat") &&
+    if (has_trait( trait_ANTIWHEAT ) && eaten->made_of("wheat") &&
         (!has_bionic("bio_digestion")) && !is_npc() &&
         !query_yn(_("Really eat that %s?  Your stomach won't be happy."), eaten->tname().c_str())) {
         return false;
     }
-    if (has_trait("CARNIVORE") && ((eaten->made_of("junk")) && !(eaten->made_of("flesh") ||
+    if (has_trait( trait_CARNIVORE ) && ((eaten->made_of("junk")) && !(eaten->made_of("flesh") ||
       eaten->made_of("hflesh") || eaten->made_of("iflesh") || eaten->made_of("milk") ||
       eaten->made_of("egg")) ) && (!has_bionic("bio_digestion")) && !is_npc() &&
         !query_yn(_("Really eat that %s?  It smells completely unappealing."), eaten->tname().c_str()) ) {
@@ -9108,7 +9364,7 @@ bool player::eat(item *eaten, it_comest *comest)
     }
     // Check for eating/Food is so water and other basic liquids that do not rot don't cause problems.
     // I'm OK with letting plants drink coffee. (Whether it would count as cannibalism is another story.)
-    if ((has_trait("SAPROPHAGE") && (!spoiled) && (!has_bionic("bio_digestion")) && !is_npc() &&
+    if ((has_trait( trait_SAPROPHAGE ) && (!spoiled) && (!has_bionic("bio_digestion")) && !is_npc() &&
       (eaten->has_flag("USE_EAT_VERB") || comest->comesttype == "FOOD") &&
       !query_yn(_("Really eat that %s?  Your stomach won't be happy."), eaten->tname().c_str()))) {
         //~ No, we don't eat "rotten" food. We eat properly aged food, like a normal person.
@@ -9121,7 +9377,7 @@ bool player::eat(item *eaten, it_comest *comest)
         if (is_npc()) {
             return false;
         }
-        if ((!(has_trait("SAPROVORE") || has_trait("SAPROPHAGE"))) &&
+        if ((!(has_trait( trait_SAPROVORE ) || has_trait( trait_SAPROPHAGE ))) &&
             !query_yn(_("This %s smells awful!  Eat it?"), eaten->tname().c_str())) {
             return false;
         }
@@ -9130,7 +9386,7 @@ bool player::eat(item *eaten, it_comest *comest)
     //not working directly in the equation... can't imagine why
     int temp_hunger = hunger - nutrition_for(comest);
     int temp_thirst = thirst - comest->quench;
-    int capacity = has_trait("GOURMAND") ? -60 : -20;
+    int capacity = has_trait( trait_GOURMAND ) ? -60 : -20;
     if( has_active_mutation("HIBERNATE") && !is_npc() &&
         // If BOTH hunger and thirst are above the capacity...
         ( hunger > capacity && thirst > capacity ) &&
@@ -9148,11 +9404,11 @@ bool player::eat(item *eaten, it_comest *comest)
     if ( has_active_mutation("HIBERNATE") ) {
         capacity = -620;
     }
-    if ( has_trait("GIZZARD") ) {
+    if ( has_trait( trait_GIZZARD ) ) {
         capacity = 0;
     }
 
-    if( has_trait("SLIMESPAWNER") && !is_npc() ) {
+    if( has_trait( trait_SLIMESPAWNER ) && !is_npc() ) {
         capacity -= 40;
         if ( (temp_hunger < capacity && temp_thirst <= (capacity + 10) ) ||
         (temp_thirst < capacity && temp_hunger <= (capacity + 10) ) ) {
@@ -9186,14 +9442,14 @@ bool player::eat(item *eaten, it_comest *comest)
 
     if( ( nutrition_for(comest) > 0 && temp_hunger < capacity ) ||
         ( comest->quench > 0 && temp_thirst < capacity ) ) {
-        if ((spoiled) && !(has_trait("SAPROPHAGE")) ){//rotten get random nutrification
+        if ((spoiled) && !(has_trait( trait_SAPROPHAGE )) ){//rotten get random nutrification
             if (!query_yn(_("You can hardly finish it all.  Consume it?"))) {
                 return false;
             }
         } else {
             if ( (( nutrition_for(comest) > 0 && temp_hunger < capacity ) ||
               ( comest->quench > 0 && temp_thirst < capacity )) &&
-              ( (!(has_trait("EATHEALTH"))) || (!(has_trait("SLIMESPAWNER"))) ) ) {
+              ( (!(has_trait( trait_EATHEALTH ))) || (!(has_trait( trait_SLIMESPAWNER ))) ) ) {
                 if (!query_yn(_("You will not be able to finish it all.  Consume it?"))) {
                 return false;
                 }
@@ -9208,19 +9464,19 @@ bool player::eat(item *eaten, it_comest *comest)
         }
     }
 
-    if ( (spoiled) && !(has_trait("SAPROPHAGE")) ) {
+    if ( (spoiled) && !(has_trait( trait_SAPROPHAGE )) ) {
         add_msg(m_bad, _("Ick, this %s doesn't taste so good..."), eaten->tname().c_str());
-        if (!has_trait("SAPROVORE") && !has_trait("EATDEAD") &&
+        if (!has_trait( trait_SAPROVORE ) && !has_trait( trait_EATDEAD ) &&
        (!has_bionic("bio_digestion") || one_in(3))) {
             add_effect("foodpoison", rng(60, (nutrition_for(comest) + 1) * 60));
         }
         consume_effects(eaten, comest, spoiled);
-    } else if ((spoiled) && has_trait("SAPROPHAGE")) {
+    } else if ((spoiled) && has_trait( trait_SAPROPHAGE )) {
         add_msg(m_good, _("Mmm, this %s tastes delicious..."), eaten->tname().c_str());
         consume_effects(eaten, comest, spoiled);
     } else {
         consume_effects(eaten, comest);
-        if (!(has_trait("GOURMAND") || has_active_mutation("HIBERNATE") || has_trait("EATHEALTH"))) {
+        if (!(has_trait( trait_GOURMAND ) || has_active_mutation("HIBERNATE") || has_trait( trait_EATHEALTH ))) {
             if ((overeating && rng(-200, 0) > hunger)) {
                 vomit();
             }
@@ -9228,16 +9484,16 @@ bool player::eat(item *eaten, it_comest *comest)
     }
     // At this point, we've definitely eaten the item, so use up some turns.
     int mealtime = 250;
-      if (has_trait("MOUTH_TENTACLES")  || has_trait ("MANDIBLES")) {
+      if (has_trait( trait_MOUTH_TENTACLES )  || has_trait( trait_MANDIBLES )) {
         mealtime /= 2;
-    } if (has_trait("GOURMAND")) {
+    } if (has_trait( trait_GOURMAND )) {
         mealtime -= 100;
-    } if ((has_trait("BEAK_HUM")) &&
+    } if ((has_trait( trait_BEAK_HUM )) &&
       (comest->comesttype == "FOOD" || eaten->has_flag("USE_EAT_VERB")) ) {
         mealtime += 200; // Much better than PROBOSCIS but still optimized for fluids
-    } if (has_trait("SABER_TEETH")) {
+    } if (has_trait( trait_SABER_TEETH )) {
         mealtime += 250; // They get In The Way
-    } if (has_trait("AMORPHOUS")) {
+    } if (has_trait( trait_AMORPHOUS )) {
         mealtime *= 1.1; // Minor speed penalty for having to flow around it
                           // rather than just grab & munch
     }
@@ -9245,7 +9501,7 @@ bool player::eat(item *eaten, it_comest *comest)
 
     // If it's poisonous... poison us.  TODO: More several poison effects
     if (eaten->poison > 0) {
-        if (!has_trait("EATPOISON") && !has_trait("EATDEAD")) {
+        if (!has_trait( trait_EATPOISON ) && !has_trait( trait_EATDEAD )) {
             if (eaten->poison >= rng(2, 4)) {
                 add_effect("poison", eaten->poison * 100);
             }
@@ -9254,7 +9510,7 @@ bool player::eat(item *eaten, it_comest *comest)
     }
 
 
-    if (has_trait("AMORPHOUS")) {
+    if (has_trait( trait_AMORPHOUS )) {
         add_msg_player_or_npc(_("You assimilate your %s."), _("<npcname> assimilates a %s."),
                                   eaten->tname().c_str());
     } else if (comest->comesttype == "DRINK" && !eaten->has_flag("USE_EAT_VERB")) {
@@ -9266,7 +9522,7 @@ bool player::eat(item *eaten, it_comest *comest)
     }
 
     // Moved this later in the process, so you actually eat it before converting to HP
-    if ( (has_trait("EATHEALTH")) && ( nutrition_for(comest) > 0 && temp_hunger < capacity ) ) {
+    if ( (has_trait( trait_EATHEALTH )) && ( nutrition_for(comest) > 0 && temp_hunger < capacity ) ) {
         int room = (capacity - temp_hunger);
         int excess_food = ((nutrition_for(comest)) - room);
         add_msg_player_or_npc( _("You feel the %s filling you out."),
@@ -9294,30 +9550,30 @@ bool player::eat(item *eaten, it_comest *comest)
         charge_power(rng(75, 300));
     }
     //eating plant fertilizer stops here
-    if (has_trait("THRESH_PLANT") && comest->can_use( "PLANTBLECH" )){
+    if (has_trait( trait_THRESH_PLANT ) && comest->can_use( "PLANTBLECH" )){
         return true;
     }
-    if (eaten->made_of("hflesh") && !has_trait("SAPIOVORE")) {
+    if (eaten->made_of("hflesh") && !has_trait( trait_SAPIOVORE )) {
     // Sapiovores don't recognize humans as the same species.
     // It's not cannibalism if you're not eating your own kind.
-      if (has_trait("CANNIBAL") && has_trait("PSYCHOPATH") && has_trait("SPIRITUAL")) {
+      if (has_trait( trait_CANNIBAL ) && has_trait( trait_PSYCHOPATH ) && has_trait( trait_SPIRITUAL )) {
           add_msg_if_player(m_good, _("You feast upon the human flesh, and in doing so, devour their spirit."));
           add_morale(MORALE_CANNIBAL, 25, 300); // You're not really consuming anything special; you just think you are.
-      } else if (has_trait("CANNIBAL") && has_trait("PSYCHOPATH")) {
+      } else if (has_trait( trait_CANNIBAL ) && has_trait( trait_PSYCHOPATH )) {
           add_msg_if_player(m_good, _("You feast upon the human flesh."));
           add_morale(MORALE_CANNIBAL, 15, 200);
-      } else if (has_trait("PSYCHOPATH") && !has_trait("CANNIBAL") && has_trait("SPIRITUAL")) {
+      } else if (has_trait( trait_PSYCHOPATH ) && !has_trait( trait_CANNIBAL ) && has_trait( trait_SPIRITUAL )) {
           add_msg_if_player( _("You greedily devour the taboo meat."));
           add_morale(MORALE_CANNIBAL, 5, 50); // Small bonus for violating a taboo.
-      } else if (has_trait("PSYCHOPATH") && !has_trait("CANNIBAL")) {
+      } else if (has_trait( trait_PSYCHOPATH ) && !has_trait( trait_CANNIBAL )) {
           add_msg_if_player( _("Meh. You've eaten worse."));
-      } else if (!has_trait("PSYCHOPATH") && has_trait("CANNIBAL") && has_trait("SPIRITUAL")) {
+      } else if (!has_trait( trait_PSYCHOPATH ) && has_trait( trait_CANNIBAL ) && has_trait( trait_SPIRITUAL )) {
           add_msg_if_player(m_good, _("You consume the sacred human flesh."));
           add_morale(MORALE_CANNIBAL, 15, 200); // Boosted because you understand the philosophical implications of your actions, and YOU LIKE THEM.
-      } else if (!has_trait("PSYCHOPATH") && has_trait("CANNIBAL")) {
+      } else if (!has_trait( trait_PSYCHOPATH ) && has_trait( trait_CANNIBAL )) {
           add_msg_if_player(m_good, _("You indulge your shameful hunger."));
           add_morale(MORALE_CANNIBAL, 10, 50);
-      } else if (!has_trait("PSYCHOPATH") && has_trait("SPIRITUAL")) {
+      } else if (!has_trait( trait_PSYCHOPATH ) && has_trait( trait_SPIRITUAL )) {
           add_msg_if_player(m_bad, _("This is probably going to count against you if there's still an afterlife."));
           add_morale(MORALE_CANNIBAL, -60, -400, 600, 300);
       } else {
@@ -9325,48 +9581,48 @@ bool player::eat(item *eaten, it_comest *comest)
           add_morale(MORALE_CANNIBAL, -60, -400, 600, 300);
       }
     }
-    if (has_trait("VEGETARIAN") && (eaten->made_of("flesh") || eaten->made_of("hflesh") || eaten->made_of("iflesh"))) {
+    if (has_trait( trait_VEGETARIAN ) && (eaten->made_of("flesh") || eaten->made_of("hflesh") || eaten->made_of("iflesh"))) {
         add_msg_if_player(m_bad, _("Yuck! How can anybody eat this stuff?"));
         add_morale(MORALE_VEGETARIAN, -75, -400, 300, 240);
     }
-    if (has_trait("MEATARIAN") && eaten->made_of("veggy")) {
+    if (has_trait( trait_MEATARIAN ) && eaten->made_of("veggy")) {
         add_msg_if_player(m_bad, _("Yuck! How can anybody eat this stuff?"));
         add_morale(MORALE_MEATARIAN, -75, -400, 300, 240);
     }
-    if (has_trait("LACTOSE") && eaten->made_of("milk")) {
+    if (has_trait( trait_LACTOSE ) && eaten->made_of("milk")) {
         add_msg_if_player(m_bad, _("Your stomach begins gurgling and you feel bloated and ill."));
         add_morale(MORALE_LACTOSE, -75, -400, 300, 240);
     }
-    if (has_trait("ANTIFRUIT") && eaten->made_of("fruit")) {
+    if (has_trait( trait_ANTIFRUIT ) && eaten->made_of("fruit")) {
         add_msg_if_player(m_bad, _("Yuck! How can anybody eat this stuff?"));
         add_morale(MORALE_ANTIFRUIT, -75, -400, 300, 240);
     }
-    if (has_trait("ANTIJUNK") && eaten->made_of("junk")) {
+    if (has_trait( trait_ANTIJUNK ) && eaten->made_of("junk")) {
         add_msg_if_player(m_bad, _("Yuck! How can anybody eat this stuff?"));
         add_morale(MORALE_ANTIJUNK, -75, -400, 300, 240);
     }
-    if (has_trait("ANTIWHEAT") && eaten->made_of("wheat")) {
+    if (has_trait( trait_ANTIWHEAT ) && eaten->made_of("wheat")) {
         add_msg_if_player(m_bad, _("Your stomach begins gurgling and you feel bloated and ill."));
         add_morale(MORALE_ANTIWHEAT, -75, -400, 300, 240);
     }
     // Carnivores CAN eat junk food, but they won't like it much.
     // Pizza-scraping happens in consume_effects.
-    if (has_trait("CARNIVORE") && ((eaten->made_of("junk")) && !(eaten->made_of("flesh") ||
+    if (has_trait( trait_CARNIVORE ) && ((eaten->made_of("junk")) && !(eaten->made_of("flesh") ||
     eaten->made_of("hflesh") || eaten->made_of("iflesh") || eaten->made_of("milk") ||
     eaten->made_of("egg")) ) ) {
         add_msg_if_player(m_bad, _("Your stomach begins gurgling and you feel bloated and ill."));
         add_morale(MORALE_NO_DIGEST, -25, -125, 300, 240);
     }
-    if (has_trait("SAPROPHAGE") && !(spoiled) && (eaten->has_flag("USE_EAT_VERB") ||
+    if (has_trait( trait_SAPROPHAGE ) && !(spoiled) && (eaten->has_flag("USE_EAT_VERB") ||
     comest->comesttype == "FOOD")) {
     // It's OK to *drink* things that haven't rotted.  Alternative is to ban water.  D:
         add_msg_if_player(m_bad, _("Your stomach begins gurgling and you feel bloated and ill."));
         add_morale(MORALE_NO_DIGEST, -75, -400, 300, 240);
     }
-    if ((!crossed_threshold() || has_trait("THRESH_URSINE")) && mutation_category_level["MUTCAT_URSINE"] > 40
+    if ((!crossed_threshold() || has_trait( trait_THRESH_URSINE )) && mutation_category_level["MUTCAT_URSINE"] > 40
         && eaten->made_of("honey")) {
         //Need at least 5 bear muts for effect to show, to filter out mutations in common with other mutcats
-        int honey_fun = has_trait("THRESH_URSINE") ?
+        int honey_fun = has_trait( trait_THRESH_URSINE ) ?
             std::min(mutation_category_level["MUTCAT_URSINE"]/8, 20) :
             mutation_category_level["MUTCAT_URSINE"]/12;
         if (honey_fun < 10)
@@ -9375,7 +9631,7 @@ bool player::eat(item *eaten, it_comest *comest)
             add_msg_if_player(m_good, _("You feast upon the sweet honey."));
         add_morale(MORALE_HONEY, honey_fun, 100);
     }
-    if( (has_trait("HERBIVORE") || has_trait("RUMINANT")) &&
+    if( (has_trait( trait_HERBIVORE ) || has_trait( trait_RUMINANT )) &&
         (eaten->made_of("flesh") || eaten->made_of("egg")) ) {
         add_msg_if_player(m_bad, _("Your stomach immediately revolts, you can't keep this disgusting stuff down."));
         if( !one_in(3) && (stomach_food || stomach_water) ) {
@@ -9414,32 +9670,32 @@ int player::nutrition_for(const it_comest *comest)
 
 void player::consume_effects(item *eaten, it_comest *comest, bool rotten)
 {
-    if (has_trait("THRESH_PLANT") && comest->can_use( "PLANTBLECH" )) {
+    if (has_trait( trait_THRESH_PLANT ) && comest->can_use( "PLANTBLECH" )) {
         return;
     }
-    if( (has_trait("HERBIVORE") || has_trait("RUMINANT")) &&
+    if( (has_trait( trait_HERBIVORE ) || has_trait( trait_RUMINANT )) &&
         (eaten->made_of("flesh") || eaten->made_of("egg")) ) {
         // No good can come of this.
         return;
     }
-    if ( !(has_trait("GIZZARD")) && (rotten) && !(has_trait("SAPROPHAGE")) ) {
+    if ( !(has_trait( trait_GIZZARD )) && (rotten) && !(has_trait( trait_SAPROPHAGE )) ) {
         hunger -= rng(0, nutrition_for(comest));
         thirst -= comest->quench;
-        if (!has_trait("SAPROVORE") && !has_bionic("bio_digestion")) {
+        if (!has_trait( trait_SAPROVORE ) && !has_bionic("bio_digestion")) {
             mod_healthy_mod(-30);
         }
-    } else if (has_trait("GIZZARD")) {
+    } else if (has_trait( trait_GIZZARD )) {
         // Carrion-eating Birds might have Saprovore; Saprophage is unlikely,
         // but best to code defensively.
         // Thanks for the warning, i2amroy.
-        if ((rotten) && !(has_trait("SAPROPHAGE")) ) {
+        if ((rotten) && !(has_trait( trait_SAPROPHAGE )) ) {
             int nut = (rng(0, nutrition_for(comest)) * 0.66 );
             int que = (comest->quench) * 0.66;
             hunger -= nut;
             thirst -= que;
             stomach_food += nut;
             stomach_water += que;
-            if (!has_trait("SAPROVORE") && !has_bionic("bio_digestion")) {
+            if (!has_trait( trait_SAPROVORE ) && !has_bionic("bio_digestion")) {
                 mod_healthy_mod(-30);
             }
         } else {
@@ -9453,7 +9709,7 @@ void player::consume_effects(item *eaten, it_comest *comest, bool rotten)
             stomach_food += (giz_nutr);
             stomach_water += (giz_quench);
         }
-    } else if (has_trait("CARNIVORE") && (eaten->made_of("veggy") || eaten->made_of("fruit") || eaten->made_of("wheat")) &&
+    } else if (has_trait( trait_CARNIVORE ) && (eaten->made_of("veggy") || eaten->made_of("fruit") || eaten->made_of("wheat")) &&
       (eaten->made_of("flesh") || eaten->made_of("hflesh") || eaten->made_of("iflesh") || eaten->made_of("milk") ||
       eaten->made_of("egg")) ) {
           // Carnivore is stripping the good stuff out of that plant crap it's mixed up with.
@@ -9467,7 +9723,7 @@ void player::consume_effects(item *eaten, it_comest *comest, bool rotten)
           stomach_food += (carn_nutr);
           stomach_water += (carn_quench);
           add_msg_if_player(m_good, _("You eat the good parts and leave that indigestible plant stuff behind."));
-    } else if (has_trait("CARNIVORE") && ((eaten->made_of("flesh") || eaten->made_of("hflesh") ||
+    } else if (has_trait( trait_CARNIVORE ) && ((eaten->made_of("flesh") || eaten->made_of("hflesh") ||
       eaten->made_of("iflesh") || eaten->made_of("egg"))) ) {
           // Carnivores, being specialized to consume meat, get more nutrients from a wholly-meat or egg meal.
           if (comest->healthy < 1) {
@@ -9515,13 +9771,13 @@ void player::consume_effects(item *eaten, it_comest *comest, bool rotten)
     if (eaten->has_flag("COLD") && eaten->has_flag("EATEN_COLD") && fun <= 0) {
             fun = 1;
     }
-    if (has_trait("GOURMAND")) {
+    if (has_trait( trait_GOURMAND )) {
         if (fun < -2) {
             add_morale(MORALE_FOOD_BAD, fun * 0.5, fun, 60, 30, false, comest);
         } else if (fun > 0) {
             add_morale(MORALE_FOOD_GOOD, fun * 3, fun * 6, 60, 30, false, comest);
         }
-        if (has_trait("GOURMAND") && !(has_active_mutation("HIBERNATE"))) {
+        if (has_trait( trait_GOURMAND ) && !(has_active_mutation("HIBERNATE"))) {
         if ((nutrition_for(comest) > 0 && hunger < -60) || (comest->quench > 0 && thirst < -60)) {
             add_msg_if_player(_("You can't finish it all!"));
         }
@@ -9585,7 +9841,7 @@ void player::consume_effects(item *eaten, it_comest *comest, bool rotten)
 
 void player::rooted_message() const
 {
-    if( (has_trait("ROOTS2") || has_trait("ROOTS3") ) &&
+    if( (has_trait( trait_ROOTS2 ) || has_trait( trait_ROOTS3 ) ) &&
         g->m.has_flag("DIGGABLE", posx(), posy()) &&
         !footwear_factor() ) {
         add_msg(m_info, _("You sink your roots into the soil."));
@@ -9597,7 +9853,7 @@ void player::rooted()
 // Overfiling triggered hibernation checks, so capping.
 {
     double shoe_factor = footwear_factor();
-    if( (has_trait("ROOTS2") || has_trait("ROOTS3")) &&
+    if( (has_trait( trait_ROOTS2 ) || has_trait( trait_ROOTS3 )) &&
         g->m.has_flag("DIGGABLE", posx(), posy()) && shoe_factor != 1.0 ) {
         if( one_in(20.0 / (1.0 - shoe_factor)) ) {
             if (hunger > -20) {
@@ -9857,41 +10113,41 @@ hint_rating player::rate_action_wear(item *it)
     if (count == 2) {
         return HINT_IFFY;
     }
-    if (has_trait("WOOLALLERGY") && (it->made_of("wool") || it->item_tags.count("wooled") > 0)) {
+    if (has_trait( trait_WOOLALLERGY ) && (it->made_of("wool") || it->item_tags.count("wooled") > 0)) {
         return HINT_IFFY; //should this be HINT_CANT? I kinda think not, because HINT_CANT is more for things that can NEVER happen
     }
     if (it->covers(bp_head) && encumb(bp_head) != 0) {
         return HINT_IFFY;
     }
-    if ((it->covers(bp_hand_l) || it->covers(bp_hand_r)) && has_trait("WEBBED")) {
+    if ((it->covers(bp_hand_l) || it->covers(bp_hand_r)) && has_trait( trait_WEBBED )) {
         return HINT_IFFY;
     }
-    if ((it->covers(bp_hand_l) || it->covers(bp_hand_r)) && has_trait("TALONS")) {
+    if ((it->covers(bp_hand_l) || it->covers(bp_hand_r)) && has_trait( trait_TALONS )) {
         return HINT_IFFY;
     }
-    if ((it->covers(bp_hand_l) || it->covers(bp_hand_r)) && (has_trait("ARM_TENTACLES") ||
-            has_trait("ARM_TENTACLES_4") || has_trait("ARM_TENTACLES_8")) ) {
+    if ((it->covers(bp_hand_l) || it->covers(bp_hand_r)) && (has_trait( trait_ARM_TENTACLES ) ||
+            has_trait( trait_ARM_TENTACLES_4 ) || has_trait( trait_ARM_TENTACLES_8 )) ) {
         return HINT_IFFY;
     }
-    if (it->covers(bp_mouth) && (has_trait("BEAK") ||
-            has_trait("BEAK_PECK") || has_trait("BEAK_HUM")) ) {
+    if (it->covers(bp_mouth) && (has_trait( trait_BEAK ) ||
+            has_trait( trait_BEAK_PECK ) || has_trait( trait_BEAK_HUM )) ) {
         return HINT_IFFY;
     }
-    if ((it->covers(bp_foot_l) || it->covers(bp_foot_r)) && has_trait("HOOVES")) {
+    if ((it->covers(bp_foot_l) || it->covers(bp_foot_r)) && has_trait( trait_HOOVES )) {
         return HINT_IFFY;
     }
-    if ((it->covers(bp_foot_l) || it->covers(bp_foot_r)) && has_trait("LEG_TENTACLES")) {
+    if ((it->covers(bp_foot_l) || it->covers(bp_foot_r)) && has_trait( trait_LEG_TENTACLES )) {
         return HINT_IFFY;
      }
-    if (it->covers(bp_head) && has_trait("HORNS_CURLED")) {
+    if (it->covers(bp_head) && has_trait( trait_HORNS_CURLED )) {
         return HINT_IFFY;
     }
-    if (it->covers(bp_torso) && (has_trait("SHELL") || has_trait("SHELL2")))  {
+    if (it->covers(bp_torso) && (has_trait( trait_SHELL ) || has_trait( trait_SHELL2 )))  {
         return HINT_IFFY;
     }
     if (it->covers(bp_head) && !it->made_of("wool") &&
           !it->made_of("cotton") && !it->made_of("leather") && !it->made_of("nomex") &&
-          (has_trait("HORNS_POINTED") || has_trait("ANTENNAE") || has_trait("ANTLERS"))) {
+          (has_trait( trait_HORNS_POINTED ) || has_trait( trait_ANTENNAE ) || has_trait( trait_ANTLERS ))) {
         return HINT_IFFY;
     }
     // Checks to see if the player is wearing shoes
@@ -10046,7 +10302,7 @@ bool player::wear_item(item *to_wear, bool interactive)
     }
 
     if (!to_wear->has_flag("OVERSIZE")) {
-        if (has_trait("WOOLALLERGY") && (to_wear->made_of("wool") || to_wear->item_tags.count("wooled"))) {
+        if (has_trait( trait_WOOLALLERGY ) && (to_wear->made_of("wool") || to_wear->item_tags.count("wooled"))) {
             if(interactive) {
                 add_msg(m_info, _("You can't wear that, it's made of wool!"));
             }
@@ -10066,7 +10322,7 @@ bool player::wear_item(item *to_wear, bool interactive)
               to_wear->covers(bp_leg_l) || to_wear->covers(bp_leg_r) ||
               to_wear->covers(bp_foot_l) || to_wear->covers(bp_foot_r) ||
               to_wear->covers(bp_torso) || to_wear->covers(bp_head)) &&
-            (has_trait("HUGE") || has_trait("HUGE_OK"))) {
+            (has_trait( trait_HUGE ) || has_trait( trait_HUGE_OK ))) {
             if(interactive) {
                 add_msg(m_info, _("The %s is much too small to fit your huge body!"),
                         to_wear->type_name().c_str());
@@ -10074,7 +10330,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if ((to_wear->covers(bp_hand_l) || to_wear->covers(bp_hand_r)) && has_trait("WEBBED"))
+        if ((to_wear->covers(bp_hand_l) || to_wear->covers(bp_hand_r)) && has_trait( trait_WEBBED ))
         {
             if(interactive)
             {
@@ -10084,8 +10340,8 @@ bool player::wear_item(item *to_wear, bool interactive)
         }
 
         if ( (to_wear->covers(bp_hand_l) || to_wear->covers(bp_hand_r)) &&
-             (has_trait("ARM_TENTACLES") || has_trait("ARM_TENTACLES_4") ||
-              has_trait("ARM_TENTACLES_8")) )
+             (has_trait( trait_ARM_TENTACLES ) || has_trait( trait_ARM_TENTACLES_4 ) ||
+              has_trait( trait_ARM_TENTACLES_8 )) )
         {
             if(interactive)
             {
@@ -10094,7 +10350,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if ((to_wear->covers(bp_hand_l) || to_wear->covers(bp_hand_r)) && has_trait("TALONS"))
+        if ((to_wear->covers(bp_hand_l) || to_wear->covers(bp_hand_r)) && has_trait( trait_TALONS ))
         {
             if(interactive)
             {
@@ -10103,7 +10359,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if ((to_wear->covers(bp_hand_l) || to_wear->covers(bp_hand_r)) && (has_trait("PAWS") || has_trait("PAWS_LARGE")) )
+        if ((to_wear->covers(bp_hand_l) || to_wear->covers(bp_hand_r)) && (has_trait( trait_PAWS ) || has_trait( trait_PAWS_LARGE )) )
         {
             if(interactive)
             {
@@ -10112,8 +10368,8 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if (to_wear->covers(bp_mouth) && (has_trait("BEAK") || has_trait("BEAK_PECK") ||
-        has_trait("BEAK_HUM")) )
+        if (to_wear->covers(bp_mouth) && (has_trait( trait_BEAK ) || has_trait( trait_BEAK_PECK ) ||
+        has_trait( trait_BEAK_HUM )) )
         {
             if(interactive)
             {
@@ -10123,8 +10379,8 @@ bool player::wear_item(item *to_wear, bool interactive)
         }
 
         if (to_wear->covers(bp_mouth) &&
-            (has_trait("MUZZLE") || has_trait("MUZZLE_BEAR") || has_trait("MUZZLE_LONG") ||
-            has_trait("MUZZLE_RAT")))
+            (has_trait( trait_MUZZLE ) || has_trait( trait_MUZZLE_BEAR ) || has_trait( trait_MUZZLE_LONG ) ||
+            has_trait( trait_MUZZLE_RAT )))
         {
             if(interactive)
             {
@@ -10133,7 +10389,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if (to_wear->covers(bp_mouth) && has_trait("MINOTAUR"))
+        if (to_wear->covers(bp_mouth) && has_trait( trait_MINOTAUR ))
         {
             if(interactive)
             {
@@ -10142,7 +10398,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if (to_wear->covers(bp_mouth) && has_trait("SABER_TEETH"))
+        if (to_wear->covers(bp_mouth) && has_trait( trait_SABER_TEETH ))
         {
             if(interactive)
             {
@@ -10151,7 +10407,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if (to_wear->covers(bp_mouth) && has_trait("MANDIBLES"))
+        if (to_wear->covers(bp_mouth) && has_trait( trait_MANDIBLES ))
         {
             if(interactive)
             {
@@ -10160,7 +10416,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if (to_wear->covers(bp_mouth) && has_trait("PROBOSCIS"))
+        if (to_wear->covers(bp_mouth) && has_trait( trait_PROBOSCIS ))
         {
             if(interactive)
             {
@@ -10169,7 +10425,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if ((to_wear->covers(bp_foot_l) || to_wear->covers(bp_foot_r)) && has_trait("HOOVES"))
+        if ((to_wear->covers(bp_foot_l) || to_wear->covers(bp_foot_r)) && has_trait( trait_HOOVES ))
         {
             if(interactive)
             {
@@ -10178,7 +10434,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if ((to_wear->covers(bp_foot_l) || to_wear->covers(bp_foot_r)) && has_trait("LEG_TENTACLES"))
+        if ((to_wear->covers(bp_foot_l) || to_wear->covers(bp_foot_r)) && has_trait( trait_LEG_TENTACLES ))
         {
             if(interactive)
             {
@@ -10187,7 +10443,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if ((to_wear->covers(bp_foot_l) || to_wear->covers(bp_foot_r)) && has_trait("RAP_TALONS"))
+        if ((to_wear->covers(bp_foot_l) || to_wear->covers(bp_foot_r)) && has_trait( trait_RAP_TALONS ))
         {
             if(interactive)
             {
@@ -10196,7 +10452,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if (to_wear->covers(bp_head) && has_trait("HORNS_CURLED"))
+        if (to_wear->covers(bp_head) && has_trait( trait_HORNS_CURLED ))
         {
             if(interactive)
             {
@@ -10205,7 +10461,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if (to_wear->covers(bp_torso) && (has_trait("SHELL") || has_trait("SHELL2")) )
+        if (to_wear->covers(bp_torso) && (has_trait( trait_SHELL ) || has_trait( trait_SHELL2 )) )
         {
             if(interactive)
             {
@@ -10214,7 +10470,7 @@ bool player::wear_item(item *to_wear, bool interactive)
             return false;
         }
 
-        if (to_wear->covers(bp_torso) && ((has_trait("INSECT_ARMS")) || (has_trait("ARACHNID_ARMS"))) )
+        if (to_wear->covers(bp_torso) && ((has_trait( trait_INSECT_ARMS )) || (has_trait( trait_ARACHNID_ARMS ))) )
         {
             if(interactive)
             {
@@ -10226,13 +10482,13 @@ bool player::wear_item(item *to_wear, bool interactive)
         if (to_wear->covers(bp_head) &&
             !to_wear->made_of("wool") && !to_wear->made_of("cotton") &&
             !to_wear->made_of("nomex") && !to_wear->made_of("leather") &&
-            (has_trait("HORNS_POINTED") || has_trait("ANTENNAE") || has_trait("ANTLERS")))
+            (has_trait( trait_HORNS_POINTED ) || has_trait( trait_ANTENNAE ) || has_trait( trait_ANTLERS )))
         {
             if(interactive)
             {
                 add_msg(m_info, _("You cannot wear a helmet over your %s."),
-                           (has_trait("HORNS_POINTED") ? _("horns") :
-                            (has_trait("ANTENNAE") ? _("antennae") : _("antlers"))));
+                           (has_trait( trait_HORNS_POINTED ) ? _("horns") :
+                            (has_trait( trait_ANTENNAE ) ? _("antennae") : _("antlers"))));
             }
             return false;
         }
@@ -10855,9 +11111,9 @@ hint_rating player::rate_action_read(item *it)
   return HINT_IFFY;
  } else if (morale_level() < MIN_MORALE_READ && it->type->book->fun <= 0) {
   return HINT_IFFY; //won't read non-fun books when sad
- } else if (it->type->book->intel > 0 && has_trait("ILLITERATE")) {
+ } else if (it->type->book->intel > 0 && has_trait( trait_ILLITERATE )) {
   return HINT_IFFY;
- } else if (has_trait("HYPEROPIC") && !is_wearing("glasses_reading")
+ } else if (has_trait( trait_HYPEROPIC ) && !is_wearing("glasses_reading")
             && !is_wearing("glasses_bifocal") && !has_effect("contacts")) {
   return HINT_IFFY;
  }
@@ -10881,7 +11137,7 @@ void player::read(int inventory_position)
     }
 
     // check for traits
-    if (has_trait("HYPEROPIC") && !is_wearing("glasses_reading") &&
+    if (has_trait( trait_HYPEROPIC ) && !is_wearing("glasses_reading") &&
         !is_wearing("glasses_bifocal") && !has_effect("contacts")) {
         add_msg(m_info, _("Your eyes won't focus without reading glasses."));
         return;
@@ -10906,7 +11162,7 @@ void player::read(int inventory_position)
     // activity.get_value(0) == 1: see below at player_activity(ACT_READ)
     const bool continuous = (activity.get_value(0) == 1);
     bool study = continuous;
-    if (tmp->intel > 0 && has_trait("ILLITERATE")) {
+    if (tmp->intel > 0 && has_trait( trait_ILLITERATE )) {
         add_msg(m_info, _("You're illiterate!"));
         return;
     }
@@ -10969,7 +11225,7 @@ void player::read(int inventory_position)
         if(!continuous) {
             add_msg(m_info, _("Now studying %s, %s to stop early."),
                     it->tname().c_str(), press_x(ACTION_PAUSE).c_str());
-            if ( (has_trait("ROOTS2") || (has_trait("ROOTS3"))) &&
+            if ( (has_trait( trait_ROOTS2 ) || (has_trait( trait_ROOTS3 ))) &&
                  g->m.has_flag("DIGGABLE", posx(), posy()) &&
                  (!(footwear_factor())) ) {
                 add_msg(m_info, _("You sink your roots into the soil."));
@@ -11010,10 +11266,10 @@ void player::read(int inventory_position)
     // away while you read more.
     int minutes = time / 1000;
     // If you don't have a problem with eating humans, To Serve Man becomes rewarding
-    if ((has_trait("CANNIBAL") || has_trait("PSYCHOPATH") || has_trait("SAPIOVORE")) &&
+    if ((has_trait( trait_CANNIBAL ) || has_trait( trait_PSYCHOPATH ) || has_trait( trait_SAPIOVORE )) &&
         it->typeId() == "cookbook_human") {
         add_morale(MORALE_BOOK, 0, 75, minutes + 30, minutes, false, it->type);
-    } else if ( has_trait("SPIRITUAL") && it->has_flag("INSPIRATIONAL") ) {
+    } else if ( has_trait( trait_SPIRITUAL ) && it->has_flag("INSPIRATIONAL") ) {
         add_morale(MORALE_BOOK, 15, 90, minutes + 60, minutes, false, it->type);
     } else {
         add_morale(MORALE_BOOK, 0, tmp->fun * 15, minutes + 30, minutes, false, it->type);
@@ -11085,11 +11341,11 @@ void player::do_read( item *book )
             fun_bonus = reading->fun * 5;
         }
         // If you don't have a problem with eating humans, To Serve Man becomes rewarding
-        if( (has_trait("CANNIBAL") || has_trait("PSYCHOPATH") || has_trait("SAPIOVORE")) &&
+        if( (has_trait( trait_CANNIBAL ) || has_trait( trait_PSYCHOPATH ) || has_trait( trait_SAPIOVORE )) &&
             book->typeId() == "cookbook_human" ) {
             fun_bonus = 25;
             add_morale(MORALE_BOOK, fun_bonus, fun_bonus * 3, 60, 30, true, book->type);
-        } else if ( has_trait("SPIRITUAL") && book->has_flag("INSPIRATIONAL") ) {
+        } else if ( has_trait( trait_SPIRITUAL ) && book->has_flag("INSPIRATIONAL") ) {
             fun_bonus = 15;
             add_morale(MORALE_BOOK, fun_bonus, fun_bonus * 5, 90, 90, true, book->type);
         } else {
@@ -11150,7 +11406,7 @@ void player::do_read( item *book )
             // Rooters root (based on time spent reading)
             int root_factor = (reading->time / 20);
             double foot_factor = footwear_factor();
-            if( (has_trait("ROOTS2") || has_trait("ROOTS3")) &&
+            if( (has_trait( trait_ROOTS2 ) || has_trait( trait_ROOTS3 )) &&
                 g->m.has_flag("DIGGABLE", posx(), posy()) &&
                 !foot_factor ) {
                 if (hunger > -20) {
@@ -11195,7 +11451,7 @@ void player::do_read( item *book )
         // Rooters root (based on time spent reading)
         int root_factor = (reading->time / 20);
         double foot_factor = footwear_factor();
-        if( (has_trait("ROOTS2") || has_trait("ROOTS3")) &&
+        if( (has_trait( trait_ROOTS2 ) || has_trait( trait_ROOTS3 )) &&
             g->m.has_flag("DIGGABLE", posx(), posy()) &&
             !foot_factor ) {
             if (hunger > -20) {
@@ -11289,7 +11545,7 @@ void player::try_to_sleep()
     bool webforce = false;
     bool websleeping = false;
     bool in_shell = false;
-    if (has_trait("CHLOROMORPH")) {
+    if (has_trait( trait_CHLOROMORPH )) {
         plantsleep = true;
         if( (ter_at_pos == t_dirt || ter_at_pos == t_pit ||
               ter_at_pos == t_dirtmound || ter_at_pos == t_pit_shallow ||
@@ -11304,11 +11560,11 @@ void player::try_to_sleep()
             add_msg(m_bad, _("Your roots scrabble ineffectively at the unyielding surface."));
         }
     }
-    if (has_trait("WEB_WALKER")) {
+    if (has_trait( trait_WEB_WALKER )) {
         websleep = true;
     }
     // Not sure how one would get Arachnid w/o web-making, but Just In Case
-    if (has_trait("THRESH_SPIDER") && (has_trait("WEB_SPINNER") || (has_trait("WEB_WEAVER"))) ) {
+    if (has_trait( trait_THRESH_SPIDER ) && (has_trait( trait_WEB_SPINNER ) || (has_trait( trait_WEB_WEAVER ))) ) {
         webforce = true;
     }
     if (websleep || webforce) {
@@ -11366,20 +11622,20 @@ bool player::can_sleep()
     if (has_addiction(ADD_SLEEP)) {
         sleepy -= 3;
     }
-    if (has_trait("INSOMNIA")) {
+    if (has_trait( trait_INSOMNIA )) {
         sleepy -= 8;
     }
-    if (has_trait("EASYSLEEPER")) {
+    if (has_trait( trait_EASYSLEEPER )) {
         sleepy += 8;
     }
-    if (has_trait("CHLOROMORPH")) {
+    if (has_trait( trait_CHLOROMORPH )) {
         plantsleep = true;
     }
-    if (has_trait("WEB_WALKER")) {
+    if (has_trait( trait_WEB_WALKER )) {
         websleep = true;
     }
     // Not sure how one would get Arachnid w/o web-making, but Just In Case
-    if (has_trait("THRESH_SPIDER") && (has_trait("WEB_SPINNER") || (has_trait("WEB_WEAVER"))) ) {
+    if (has_trait( trait_THRESH_SPIDER ) && (has_trait( trait_WEB_SPINNER ) || (has_trait( trait_WEB_WEAVER ))) ) {
         webforce = true;
     }
     if (has_active_mutation("SHELL2")) {
@@ -11539,7 +11795,7 @@ float player::fine_detail_vision_mod()
     // that you can generaly see.  There'll still be the haze, but
     // it's annoying rather than limiting.
     if ((has_effect("blind") || worn_with_flag("BLIND")) || ((has_effect("boomered")) &&
-    !(has_trait("PER_SLIME_OK"))))
+    !(has_trait( trait_PER_SLIME_OK ))))
     {
         return 5;
     }
@@ -11567,11 +11823,11 @@ float player::fine_detail_vision_mod()
         vision_ii -= 1;
     }
 
-    if (has_trait("NIGHTVISION")) { vision_ii -= .5; }
-    else if (has_trait("ELFA_NV")) { vision_ii -= 1; }
-    else if (has_trait("NIGHTVISION2") || has_trait("FEL_NV") || has_trait("URSINE_EYE")) { vision_ii -= 2; }
-    else if (has_trait("NIGHTVISION3") || has_trait("ELFA_FNV") || is_wearing("rm13_armor_on") ||
-      has_trait("CEPH_VISION")) {
+    if (has_trait( trait_NIGHTVISION )) { vision_ii -= .5; }
+    else if (has_trait( trait_ELFA_NV )) { vision_ii -= 1; }
+    else if (has_trait( trait_NIGHTVISION2 ) || has_trait( trait_FEL_NV ) || has_trait( trait_URSINE_EYE )) { vision_ii -= 2; }
+    else if (has_trait( trait_NIGHTVISION3 ) || has_trait( trait_ELFA_FNV ) || is_wearing("rm13_armor_on") ||
+      has_trait( trait_CEPH_VISION )) {
         vision_ii -= 3;
     }
 
@@ -11581,36 +11837,7 @@ float player::fine_detail_vision_mod()
 
 int player::get_wind_resistance(body_part bp) const
 {
-    int coverage = 0;
-    float totalExposed = 1.0;
     int totalCoverage = 0;
-    int penalty = 100;
-
-    for (auto &i : worn)
-    {
-        if (i.covers(bp))
-        {
-            if (i.made_of("leather") || i.made_of("plastic") || i.made_of("bone") || i.made_of("chitin") || i.made_of("nomex"))
-            {
-                penalty = 10; // 90% effective
-            }
-            else if (i.made_of("cotton"))
-            {
-                penalty = 30;
-            }
-            else if (i.made_of("wool"))
-            {
-                penalty = 40;
-            }
-            else
-            {
-                penalty = 1; // 99% effective
-            }
-
-            coverage = std::max(0, i.get_coverage() - penalty);
-            totalExposed *= (1.0 - coverage/100.0); // Coverage is between 0 and 1?
-        }
-    }
 
     // Your shell provides complete wind protection if you're inside it
     if (has_active_mutation("SHELL2")) {
@@ -11618,26 +11845,21 @@ int player::get_wind_resistance(body_part bp) const
         return totalCoverage;
     }
 
-    totalCoverage = 100 - totalExposed*100;
+    totalCoverage = 100 - worn_summary().wind_exposed[bp]*100;
 
     return totalCoverage;
 }
 
 int player::warmth(body_part bp) const
 {
-    int ret = 0, warmth = 0;
+    const worn_gear_summary &summary = worn_summary();
+    int ret = summary.wool_warmth[bp];
 
-    for (auto &i : worn) {
-        if( i.covers( bp ) ) {
-            warmth = i.get_warmth();
-            // Wool items do not lose their warmth due to being wet.
-            // Warmth is reduced by 0 - 66% based on wetness.
-            if (!i.made_of("wool"))
-            {
-                warmth *= 1.0 - 0.66 * body_wetness[bp] / mDrenchEffect.at(bp);
-            }
-            ret += warmth;
-        }
+    for( int warmth : summary.other_warmth[bp] ) {
+        // Wool items do not lose their warmth due to being wet.
+        // Warmth is reduced by 0 - 66% based on wetness.
+        warmth *= 1.0 - 0.66 * body_wetness[bp] / mDrenchEffect.at(bp);
+        ret += warmth;
     }
     return ret;
 }
@@ -11659,52 +11881,46 @@ int player::bonus_warmth(body_part bp) const
 
     // If the player is not wielding anything big, check if hands can be put in pockets
     if( ( bp == bp_hand_l || bp == bp_hand_r ) && weapon.volume() < 2 ) {
-        ret += bestwarmth( worn, "POCKETS" );
+        ret += worn_summary().pockets_warmth;
     }
 
     // If the player's head is not encumbered, check if hood can be put up
     if( bp == bp_head && encumb( bp_head ) < 10 ) {
-        ret += bestwarmth( worn, "HOOD" );
+        ret += worn_summary().hood_warmth;
     }
 
     // If the player's mouth is not encumbered, check if collar can be put up
     if( bp == bp_mouth && encumb( bp_mouth ) < 10 ) {
-        ret += bestwarmth( worn, "COLLAR" );
+        ret += worn_summary().collar_warmth;
     }
 
     return ret;
 }
 
-int player::encumb( body_part bp ) const
+static size_t hash_item_tags( const std::set<std::string> &tags )
 {
-    int iArmorEnc = 0;
-    double iLayers = 0;
-    return encumb(bp, iLayers, iArmorEnc);
+    size_t result = tags.size();
+    for( auto &tag : tags ) {
+        result ^= std::hash<std::string>()( tag ) + 0x9e3779b9 + ( result << 6 ) + ( result >> 2 );
+    }
+    return result;
 }
 
-
-/*
- * Encumbrance logic:
- * Some clothing is intrinsically encumbering, such as heavy jackets, backpacks, body armor, etc.
- * These simply add their encumbrance value to each body part they cover.
- * In addition, each article of clothing after the first in a layer imposes an additional penalty.
- * e.g. one shirt will not encumber you, but two is tight and starts to restrict movement.
- * Clothes on seperate layers don't interact, so if you wear e.g. a light jacket over a shirt,
- * they're intended to be worn that way, and don't impose a penalty.
- * The default is to assume that clothes do not fit, clothes that are "fitted" either
- * reduce the encumbrance penalty by ten, or if that is already 0, they reduce the layering effect.
- *
- * Use cases:
- * What would typically be considered normal "street clothes" should not be considered encumbering.
- * Tshirt, shirt, jacket on torso/arms, underwear and pants on legs, socks and shoes on feet.
- * This is currently handled by each of these articles of clothing
- * being on a different layer and/or body part, therefore accumulating no encumbrance.
- */
-int player::encumb(body_part bp, double &layers, int &armorenc) const
+const player::worn_gear_summary &player::worn_summary() const
 {
-    int ret = 0;
-    double layer[MAX_CLOTHING_LAYER] = { };
-    int level = 0;
+    std::vector<worn_item_key> &keys = worn_keys_buffer;
+    keys.clear();
+    for( auto &w : worn ) {
+        keys.push_back( worn_item_key{ w.type, w.get_covered_body_parts().to_ulong(),
+                                       hash_item_tags( w.item_tags ), w.contents.size(), w.damage,
+                                       w.active } );
+    }
+    if( keys == worn_gear.keys ) {
+        return worn_gear;
+    }
+    worn_gear = worn_gear_summary();
+    std::swap( worn_gear.keys, keys );
+
     bool is_wearing_active_power_armor = false;
     for( auto &w : worn ) {
         if( w.active && w.is_power_armor() ) {
@@ -11713,27 +11929,37 @@ int player::encumb(body_part bp, double &layers, int &armorenc) const
         }
     }
 
-    for (size_t i = 0; i < worn.size(); ++i) {
-        if( worn[i].covers(bp) ) {
-            if( worn[i].has_flag( "SKINTIGHT" ) ) {
+    for( int i = 0; i < num_bp; i++ ) {
+        const body_part bp = static_cast<body_part>( i );
+        double layer[MAX_CLOTHING_LAYER] = { };
+        int level = 0;
+        int &armorenc = worn_gear.armorenc[bp];
+        float totalExposed = 1.0;
+        for( auto &w : worn ) {
+            if( !w.covers( bp ) ) {
+                continue;
+            }
+            worn_gear.covered.set( bp );
+
+            if( w.has_flag( "SKINTIGHT" ) ) {
                 level = UNDERWEAR;
-            } else if ( worn[i].has_flag( "WAIST" ) ) {
+            } else if ( w.has_flag( "WAIST" ) ) {
                 level = WAIST_LAYER;
-            } else if ( worn[i].has_flag( "OUTER" ) ) {
+            } else if ( w.has_flag( "OUTER" ) ) {
                 level = OUTER_LAYER;
-            } else if ( worn[i].has_flag( "BELTED") ) {
+            } else if ( w.has_flag( "BELTED") ) {
                 level = BELTED_LAYER;
             } else {
                 level = REGULAR_LAYER;
             }
 
             layer[level] += 10;
-            if( worn[i].is_power_armor() && is_wearing_active_power_armor ) {
-                armorenc += std::max( 0, worn[i].get_encumber() - 40);
+            if( w.is_power_armor() && is_wearing_active_power_armor ) {
+                armorenc += std::max( 0, w.get_encumber() - 40);
             } else {
-                int newenc = worn[i].get_encumber();
+                int newenc = w.get_encumber();
                 // Fitted clothes will reduce either encumbrance or layering.
-                if( worn[i].has_flag( "FIT" ) ) {
+                if( w.has_flag( "FIT" ) ) {
                     if( newenc > 0 ) {
                         newenc = std::max( 0, newenc - 10 );
                     } else if (layer[level] > 0) {
@@ -11743,16 +11969,92 @@ int player::encumb(body_part bp, double &layers, int &armorenc) const
 
                 armorenc += newenc;
             }
+
+            if( w.made_of( "wool" ) ) {
+                worn_gear.wool_warmth[bp] += w.get_warmth();
+            } else {
+                worn_gear.other_warmth[bp].push_back( w.get_warmth() );
+            }
+
+            int penalty = 100;
+            if (w.made_of("leather") || w.made_of("plastic") || w.made_of("bone") || w.made_of("chitin") || w.made_of("nomex"))
+            {
+                penalty = 10; // 90% effective
+            }
+            else if (w.made_of("cotton"))
+            {
+                penalty = 30;
+            }
+            else if (w.made_of("wool"))
+            {
+                penalty = 40;
+            }
+            else
+            {
+                penalty = 1; // 99% effective
+            }
+            const int coverage = std::max(0, w.get_coverage() - penalty);
+            totalExposed *= (1.0 - coverage/100.0); // Coverage is between 0 and 1?
+        }
+        worn_gear.wind_exposed[bp] = totalExposed;
+
+        for( auto &elem : layer ) {
+            worn_gear.layers[bp] += std::max( 0.0, elem - 10.0 );
+        }
+    }
+
+    worn_gear.pockets_warmth = bestwarmth( worn, "POCKETS" );
+    worn_gear.hood_warmth = bestwarmth( worn, "HOOD" );
+    worn_gear.collar_warmth = bestwarmth( worn, "COLLAR" );
+
+    for( auto &w : worn ) {
+        if( !w.is_power_armor() ) {
+            continue;
+        }
+        worn_gear.power_armor = true;
+        if( w.covers( bp_head ) ) {
+            worn_gear.power_armor_helmet = true;
         }
     }
+    return worn_gear;
+}
+
+int player::encumb( body_part bp ) const
+{
+    int iArmorEnc = 0;
+    double iLayers = 0;
+    return encumb(bp, iLayers, iArmorEnc);
+}
+
+
+/*
+ * Encumbrance logic:
+ * Some clothing is intrinsically encumbering, such as heavy jackets, backpacks, body armor, etc.
+ * These simply add their encumbrance value to each body part they cover.
+ * In addition, each article of clothing after the first in a layer imposes an additional penalty.
+ * e.g. one shirt will not encumber you, but two is tight and starts to restrict movement.
+ * Clothes on seperate layers don't interact, so if you wear e.g. a light jacket over a shirt,
+ * they're intended to be worn that way, and don't impose a penalty.
+ * The default is to assume that clothes do not fit, clothes that are "fitted" either
+ * reduce the encumbrance penalty by ten, or if that is already 0, they reduce the layering effect.
+ *
+ * Use cases:
+ * What would typically be considered normal "street clothes" should not be considered encumbering.
+ * Tshirt, shirt, jacket on torso/arms, underwear and pants on legs, socks and shoes on feet.
+ * This is currently handled by each of these articles of clothing
+ * being on a different layer and/or body part, therefore accumulating no encumbrance.
+ */
+int player::encumb(body_part bp, double &layers, int &armorenc) const
+{
+    int ret = 0;
+    const worn_gear_summary &summary = worn_summary();
+    armorenc += summary.armorenc[bp];
     if (armorenc < 0) {
         armorenc = 0;
     }
     ret += armorenc;
 
-    for( auto &elem : layer ) {
-        layers += std::max( 0.0, elem - 10.0 );
-    }
+    layers += summary.layers[bp];
 
     if (layers > 5.0) {
         ret += (layers);
@@ -11766,44 +12068,44 @@ int player::encumb(body_part bp, double &layers, int &armorenc) const
     if ( has_bionic("bio_stiff") && bp != bp_head && bp != bp_mouth && bp != bp_eyes ) {
         ret += 10;
     }
-    if ( (has_trait("CHITIN3") || has_trait("CHITIN_FUR3") ) &&
+    if ( (has_trait( trait_CHITIN3 ) || has_trait( trait_CHITIN_FUR3 ) ) &&
       bp != bp_eyes && bp != bp_mouth ) {
         ret += 10;
     }
-    if ( has_trait("SLIT_NOSTRILS") && bp == bp_mouth ) {
+    if ( has_trait( trait_SLIT_NOSTRILS ) && bp == bp_mouth ) {
         ret += 10;
     }
-    if ( has_trait("ARM_FEATHERS") && (bp == bp_arm_l || bp == bp_arm_r) ) {
+    if ( has_trait( trait_ARM_FEATHERS ) && (bp == bp_arm_l || bp == bp_arm_r) ) {
         ret += 20;
     }
-    if ( has_trait("INSECT_ARMS") && (bp == bp_arm_l || bp == bp_arm_r) ) {
+    if ( has_trait( trait_INSECT_ARMS ) && (bp == bp_arm_l || bp == bp_arm_r) ) {
         ret += 30;
     }
-    if ( has_trait("ARACHNID_ARMS") && (bp == bp_arm_l || bp == bp_arm_r) ) {
+    if ( has_trait( trait_ARACHNID_ARMS ) && (bp == bp_arm_l || bp == bp_arm_r) ) {
         ret += 40;
     }
-    if ( has_trait("PAWS") && (bp == bp_hand_l || bp == bp_hand_r) ) {
+    if ( has_trait( trait_PAWS ) && (bp == bp_hand_l || bp == bp_hand_r) ) {
         ret += 10;
     }
-    if ( has_trait("PAWS_LARGE") && (bp == bp_hand_l || bp == bp_hand_r) ) {
+    if ( has_trait( trait_PAWS_LARGE ) && (bp == bp_hand_l || bp == bp_hand_r) ) {
         ret += 20;
     }
-    if ( has_trait("LARGE") && (bp == bp_arm_l || bp == bp_arm_r || bp == bp_torso )) {
+    if ( has_trait( trait_LARGE ) && (bp == bp_arm_l || bp == bp_arm_r || bp == bp_torso )) {
         ret += 10;
     }
-    if ( has_trait("WINGS_BUTTERFLY") && (bp == bp_torso )) {
+    if ( has_trait( trait_WINGS_BUTTERFLY ) && (bp == bp_torso )) {
         ret += 10;
     }
-    if ( has_trait("SHELL2") && (bp == bp_torso )) {
+    if ( has_trait( trait_SHELL2 ) && (bp == bp_torso )) {
         ret += 10;
     }
     if ((bp == bp_hand_l || bp == bp_hand_r) &&
-        (has_trait("ARM_TENTACLES") || has_trait("ARM_TENTACLES_4") ||
-         has_trait("ARM_TENTACLES_8")) ) {
+        (has_trait( trait_ARM_TENTACLES ) || has_trait( trait_ARM_TENTACLES_4 ) ||
+         has_trait( trait_ARM_TENTACLES_8 )) ) {
         ret += 30;
     }
     if ((bp == bp_hand_l || bp == bp_hand_r) &&
-        (has_trait("CLAWS_TENTACLE") )) {
+        (has_trait( trait_CLAWS_TENTACLE ) )) {
         ret += 20;
     }
     if (bp == bp_mouth &&
@@ -11860,28 +12162,28 @@ int player::get_armor_bash_base(body_part bp) const
     if (bp == bp_eyes && has_bionic("bio_armor_eyes")) {
         ret += 3;
     }
-    if (has_trait("FUR") || has_trait("LUPINE_FUR") || has_trait("URSINE_FUR")) {
+    if (has_trait( trait_FUR ) || has_trait( trait_LUPINE_FUR ) || has_trait( trait_URSINE_FUR )) {
         ret++;
     }
-    if (bp == bp_head && has_trait("LYNX_FUR")) {
+    if (bp == bp_head && has_trait( trait_LYNX_FUR )) {
         ret++;
     }
-    if (has_trait("FAT")) {
+    if (has_trait( trait_FAT )) {
         ret ++;
     }
-    if (has_trait("M_SKIN")) {
+    if (has_trait( trait_M_SKIN )) {
         ret += 2;
     }
-    if (has_trait("M_SKIN2")) {
+    if (has_trait( trait_M_SKIN2 )) {
         ret += 3;
     }
-    if (has_trait("CHITIN")) {
+    if (has_trait( trait_CHITIN )) {
         ret += 2;
     }
-    if (has_trait("SHELL") && bp == bp_torso) {
+    if (has_trait( trait_SHELL ) && bp == bp_torso) {
         ret += 6;
     }
-    if (has_trait("SHELL2") && !has_active_mutation("SHELL2") && bp == bp_torso) {
+    if (has_trait( trait_SHELL2 ) && !has_active_mutation("SHELL2") && bp == bp_torso) {
         ret += 9;
     }
     if (has_active_mutation("SHELL2")) {
@@ -11913,40 +12215,40 @@ int player::get_armor_cut_base(body_part bp) const
     } else if (bp == bp_eyes && has_bionic("bio_armor_eyes")) {
         ret += 3;
     }
-    if (has_trait("THICKSKIN")) {
+    if (has_trait( trait_THICKSKIN )) {
         ret++;
     }
-    if (has_trait("THINSKIN")) {
+    if (has_trait( trait_THINSKIN )) {
         ret--;
     }
-    if (has_trait("M_SKIN")) {
+    if (has_trait( trait_M_SKIN )) {
         ret ++;
     }
-    if (has_trait("M_SKIN2")) {
+    if (has_trait( trait_M_SKIN2 )) {
         ret += 3;
     }
-    if (has_trait("SCALES")) {
+    if (has_trait( trait_SCALES )) {
         ret += 2;
     }
-    if (has_trait("THICK_SCALES")) {
+    if (has_trait( trait_THICK_SCALES )) {
         ret += 4;
     }
-    if (has_trait("SLEEK_SCALES")) {
+    if (has_trait( trait_SLEEK_SCALES )) {
         ret += 1;
     }
-    if (has_trait("CHITIN") || has_trait("CHITIN_FUR")) {
+    if (has_trait( trait_CHITIN ) || has_trait( trait_CHITIN_FUR )) {
         ret += 2;
     }
-    if (has_trait("CHITIN2") || has_trait("CHITIN_FUR2")) {
+    if (has_trait( trait_CHITIN2 ) || has_trait( trait_CHITIN_FUR2 )) {
         ret += 4;
     }
-    if (has_trait("CHITIN3") || has_trait("CHITIN_FUR3")) {
+    if (has_trait( trait_CHITIN3 ) || has_trait( trait_CHITIN_FUR3 )) {
         ret += 8;
     }
-    if (has_trait("SHELL") && bp == bp_torso) {
+    if (has_trait( trait_SHELL ) && bp == bp_torso) {
         ret += 14;
     }
-    if (has_trait("SHELL2") && !has_active_mutation("SHELL2") && bp == bp_torso) {
+    if (has_trait( trait_SHELL2 ) && !has_active_mutation("SHELL2") && bp == bp_torso) {
         ret += 17;
     }
     if (has_active_mutation("SHELL2")) {
@@ -12138,73 +12440,73 @@ void player::absorb_hit(body_part bp, damage_instance &dam) {
             }
         }
         if( elem.type == DT_CUT ) {
-            if( has_trait("THICKSKIN") ) {
+            if( has_trait( trait_THICKSKIN ) ) {
                 elem.amount -= 1;
             }
-            if( has_trait("THINSKIN") ) {
+            if( has_trait( trait_THINSKIN ) ) {
                 elem.amount += 1;
             }
-            if (has_trait("SCALES")) {
+            if (has_trait( trait_SCALES )) {
                 elem.amount -= 2;
             }
-            if (has_trait("THICK_SCALES")) {
+            if (has_trait( trait_THICK_SCALES )) {
                 elem.amount -= 4;
             }
-            if (has_trait("SLEEK_SCALES")) {
+            if (has_trait( trait_SLEEK_SCALES )) {
                 elem.amount -= 1;
             }
-            if (has_trait("FAT")) {
+            if (has_trait( trait_FAT )) {
                 elem.amount --;
             }
-            if (has_trait("CHITIN") || has_trait("CHITIN_FUR") || has_trait("CHITIN_FUR2")) {
+            if (has_trait( trait_CHITIN ) || has_trait( trait_CHITIN_FUR ) || has_trait( trait_CHITIN_FUR2 )) {
                 elem.amount -= 2;
             }
-            if ((bp == bp_foot_l || bp == bp_foot_r) && has_trait("HOOVES")) {
+            if ((bp == bp_foot_l || bp == bp_foot_r) && has_trait( trait_HOOVES )) {
                 elem.amount--;
             }
-            if (has_trait("CHITIN2")) {
+            if (has_trait( trait_CHITIN2 )) {
                 elem.amount -= 4;
             }
-            if (has_trait("CHITIN3") || has_trait("CHITIN_FUR3")) {
+            if (has_trait( trait_CHITIN3 ) || has_trait( trait_CHITIN_FUR3 )) {
                 elem.amount -= 8;
             }
             elem.amount -= mabuff_arm_cut_bonus();
         }
         if( elem.type == DT_BASH ) {
-            if (has_trait("FEATHERS")) {
+            if (has_trait( trait_FEATHERS )) {
                 elem.amount--;
             }
-            if (has_trait("AMORPHOUS")) {
+            if (has_trait( trait_AMORPHOUS )) {
                 elem.amount--;
-                if (!(has_trait("INT_SLIME"))) {
+                if (!(has_trait( trait_INT_SLIME ))) {
                     elem.amount -= 3;
                 }
             }
-            if ((bp == bp_arm_l || bp == bp_arm_r) && has_trait("ARM_FEATHERS")) {
+            if ((bp == bp_arm_l || bp == bp_arm_r) && has_trait( trait_ARM_FEATHERS )) {
                 elem.amount--;
             }
-            if (has_trait("FUR") || has_trait("LUPINE_FUR") || has_trait("URSINE_FUR")) {
+            if (has_trait( trait_FUR ) || has_trait( trait_LUPINE_FUR ) || has_trait( trait_URSINE_FUR )) {
                 elem.amount--;
             }
-            if (bp == bp_head && has_trait("LYNX_FUR")) {
+            if (bp == bp_head && has_trait( trait_LYNX_FUR )) {
                 elem.amount--;
             }
-            if (has_trait("CHITIN2")) {
+            if (has_trait( trait_CHITIN2 )) {
                 elem.amount--;
             }
-            if (has_trait("CHITIN3") || has_trait("CHITIN_FUR3")) {
+            if (has_trait( trait_CHITIN3 ) || has_trait( trait_CHITIN_FUR3 )) {
                 elem.amount -= 2;
             }
-            if (has_trait("PLANTSKIN")) {
+            if (has_trait( trait_PLANTSKIN )) {
                 elem.amount--;
             }
-            if (has_trait("BARK")) {
+            if (has_trait( trait_BARK )) {
                 elem.amount -= 2;
             }
-            if (has_trait("LIGHT_BONES")) {
+            if (has_trait( trait_LIGHT_BONES )) {
                 elem.amount *= 1.4;
             }
-            if (has_trait("HOLLOW_BONES")) {
+            if (has_trait( trait_HOLLOW_BONES )) {
                 elem.amount *= 1.8;
             }
             elem.amount -= mabuff_arm_bash_bonus();
@@ -12244,11 +12546,7 @@ int player::get_env_resist(body_part bp) const
 
 bool player::wearing_something_on(body_part bp) const
 {
-    for (auto &i : worn) {
-        if (i.covers(bp))
-            return true;
-    }
-    return false;
+    return worn_summary().covered.test( bp );
 }
 
 bool player::is_wearing_shoes(std::string side) const
@@ -12307,33 +12605,21 @@ int player::shoe_type_count(const itype_id & it) const
 }
 
 bool player::is_wearing_power_armor(bool *hasHelmet) const {
-    bool result = false;
-    for( auto &elem : worn ) {
-        if( !elem.is_power_armor() ) {
-            continue;
-        }
-        if (hasHelmet == NULL) {
-            // found power armor, helmet not requested, cancel loop
-            return true;
-        }
-        // found power armor, continue search for helmet
-        result = true;
-        if( elem.covers( bp_head ) ) {
-            *hasHelmet = true;
-            return true;
-        }
+    const worn_gear_summary &summary = worn_summary();
+    if( hasHelmet != NULL && summary.power_armor_helmet ) {
+        *hasHelmet = true;
     }
-    return result;
+    return summary.power_armor;
 }
 
 int player::adjust_for_focus(int amount)
 {
     int effective_focus = focus_pool;
-    if (has_trait("FASTLEARNER"))
+    if (has_trait( trait_FASTLEARNER ))
     {
         effective_focus += 15;
     }
-    if (has_trait("SLOWLEARNER"))
+    if (has_trait( trait_SLOWLEARNER ))
     {
         effective_focus -= 15;
     }
@@ -12358,7 +12644,7 @@ void player::practice( const Skill* s, int amount, int cap )
         }
     }
 
-    bool isSavant = has_trait("SAVANT");
+    bool isSavant = has_trait( trait_SAVANT );
 
     const Skill* savantSkill = NULL;
     SkillLevel savantSkillLevel = SkillLevel();
@@ -12374,21 +12660,21 @@ void player::practice( const Skill* s, int amount, int cap )
 
     amount = adjust_for_focus(amount);
 
-    if (has_trait("PACIFIST") && s->is_combat_skill()) {
+    if (has_trait( trait_PACIFIST ) && s->is_combat_skill()) {
         if(!one_in(3)) {
           amount = 0;
         }
     }
-    if (has_trait("PRED2") && s->is_combat_skill()) {
+    if (has_trait( trait_PRED2 ) && s->is_combat_skill()) {
         if(one_in(3)) {
           amount *= 2;
         }
     }
-    if (has_trait("PRED3") && s->is_combat_skill()) {
+    if (has_trait( trait_PRED3 ) && s->is_combat_skill()) {
         amount *= 2;
     }
 
-    if (has_trait("PRED4") && s->is_combat_skill()) {
+    if (has_trait( trait_PRED4 ) && s->is_combat_skill()) {
         amount *= 3;
     }
 
@@ -12422,7 +12708,7 @@ void player::practice( const Skill* s, int amount, int cap )
         focus_pool -= chance_to_drop / 100;
         // Apex Predators don't think about much other than killing.
         // They don't lose Focus when practicing combat skills.
-        if ((rng(1, 100) <= (chance_to_drop % 100)) && (!(has_trait("PRED4") &&
+        if ((rng(1, 100) <= (chance_to_drop % 100)) && (!(has_trait( trait_PRED4 ) &&
                                                           s->is_combat_skill()))) {
             focus_pool--;
         }
@@ -12826,7 +13112,7 @@ bool player::is_invisible() const {
         has_active_bionic(str_bio_cloak) ||
         has_active_bionic(str_bio_night) ||
         has_active_optcloak() ||
-        has_trait("DEBUG_CLOAK") ||
+        has_trait( trait_DEBUG_CLOAK ) ||
         has_artifact_with(AEP_INVISIBLE)
     );
 }
@@ -12935,11 +13221,11 @@ int player::get_hp_max( hp_part bp ) const
 }
 
 field_id player::playerBloodType() const {
-    if (has_trait("THRESH_PLANT"))
+    if (has_trait( trait_THRESH_PLANT ))
         return fd_blood_veggy;
-    if (has_trait("THRESH_INSECT") || has_trait("THRESH_SPIDER"))
+    if (has_trait( trait_THRESH_INSECT ) || has_trait( trait_THRESH_SPIDER ))
         return fd_blood_insect;
-    if (has_trait("THRESH_CEPHALOPOD"))
+    if (has_trait( trait_THRESH_CEPHALOPOD ))
         return fd_blood_invertebrate;
     return fd_blood;
 }
@@ -13003,7 +13289,7 @@ bool player::sees( const Creature &critter, int &bresenham_slope ) const
 {
     // This handles only the player/npc specific stuff (monsters don't have traits or bionics).
     const int dist = rl_dist( pos(), critter.pos() );
-    if (dist <= 3 && has_trait("ANTENNAE")) {
+    if (dist <= 3 && has_trait( trait_ANTENNAE )) {
         return true;
     }
     if( critter.digging() && has_active_bionic( "bio_ground_sonar" ) ) {
@@ -13143,25 +13429,25 @@ float player::hearing_ability() const
     if( has_active_bionic("bio_ears") && !has_active_bionic("bio_earplugs") ) {
         volume_multiplier *= 3.5;
     }
-    if( has_trait("PER_SLIME") ) {
+    if( has_trait( trait_PER_SLIME ) ) {
         // Random hearing :-/
         // (when it's working at all, see player.cpp)
         // changed from 0.5 to fix Mac compiling error
         volume_multiplier *= (rng(1, 2));
     }
-    if( has_trait("BADHEARING") ) {
+    if( has_trait( trait_BADHEARING ) ) {
         volume_multiplier *= .5;
     }
-    if( has_trait("GOODHEARING") ) {
+    if( has_trait( trait_GOODHEARING ) ) {
         volume_multiplier *= 1.25;
     }
-    if( has_trait("CANINE_EARS") ) {
+    if( has_trait( trait_CANINE_EARS ) ) {
         volume_multiplier *= 1.5;
     }
-    if( has_trait("URSINE_EARS") || has_trait("FELINE_EARS") ) {
+    if( has_trait( trait_URSINE_EARS ) || has_trait( trait_FELINE_EARS ) ) {
         volume_multiplier *= 1.25;
     }
-    if( has_trait("LUPINE_EARS") ) {
+    if( has_trait( trait_LUPINE_EARS ) ) {
         volume_multiplier *= 1.75;
     }
     return volume_multiplier;
@@ -13227,8 +13513,8 @@ void player::place_corpse()
 bool player::sees_with_infrared( const Creature &critter ) const
 {
     const bool has_ir = has_active_bionic( "bio_infrared" ) ||
-                        has_trait( "INFRARED" ) ||
-                        has_trait( "LIZ_IR" ) ||
+                        has_trait( trait_INFRARED ) ||
+                        has_trait( trait_LIZ_IR ) ||
                         worn_with_flag( "IR_EFFECT" );
     if( !has_ir || !critter.is_warm() ) {
         return false;
@@ -13349,7 +13635,7 @@ float player::power_rating() const
     } else if( weapon.damage_bash() + weapon.damage_cut() > 20 ) {
         ret = 3; // Melee weapon or weapon-y tool
     }
-    if( has_trait("HUGE") || has_trait("HUGE_OK") ) {
+    if( has_trait( trait_HUGE ) || has_trait( trait_HUGE_OK ) ) {
         ret += 1;
     }
     if( is_wearing_power_armor( nullptr ) ) {
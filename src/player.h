@@ -17,6 +17,7 @@
 #include <unordered_set>
 #include <bitset>
 #include <array>
+#include <algorithm>
 
 static const std::string DEFAULT_HOTKEYS("1234567890abcdefghijklmnopqrstuvwxyz");
 
@@ -1123,6 +1124,58 @@ class player : public Character, public JsonSerializer, public JsonDeserializer
         int cached_turn;
         point cached_position;
 
+        /** The properties of a worn item that the @ref worn_gear_summary depends on. */
+        struct worn_item_key {
+            const itype *type;
+            unsigned long covered;
+            /** Hash of the item tags, they include the padding read by get_encumber / get_warmth. */
+            size_t tags;
+            size_t contents;
+            int damage;
+            bool active;
+
+            bool operator==( const worn_item_key &rhs ) const {
+                return type == rhs.type && covered == rhs.covered && tags == rhs.tags &&
+                       contents == rhs.contents && damage == rhs.damage && active == rhs.active;
+            }
+        };
+        /**
+         * Per body part totals over the worn items, which are needed by several functions for
+         * each body part each turn. Use @ref worn_summary to get it.
+         */
+        struct worn_gear_summary {
+            /** Encumbrance of the items, see @ref encumb. */
+            int armorenc[num_bp] = {};
+            /** Layering penalty, see @ref encumb. */
+            double layers[num_bp] = {};
+            /** Warmth of the wool items, they stay warm when wet. */
+            int wool_warmth[num_bp] = {};
+            /** Warmth of each of the other items, it's reduced when they are wet. */
+            std::vector<int> other_warmth[num_bp];
+            /** Part of the body part exposed to wind, 0 - 1. */
+            float wind_exposed[num_bp];
+            std::bitset<num_bp> covered;
+            /** Best warmth of an item with the POCKETS / HOOD / COLLAR flag. */
+            int pockets_warmth = 0;
+            int hood_warmth = 0;
+            int collar_warmth = 0;
+            bool power_armor = false;
+            bool power_armor_helmet = false;
+            /** The worn items this was computed from. */
+            std::vector<worn_item_key> keys;
+
+            worn_gear_summary() {
+                std::fill_n( wind_exposed, static_cast<int>( num_bp ), 1.0f );
+            }
+        };
+        mutable worn_gear_summary worn_gear;
+        mutable std::vector<worn_item_key> worn_keys_buffer;
+        /**
+         * Returns the summary of the worn items, it's recomputed if any of them has been
+         * changed since the last call (see @ref worn_item_key).
+         */
+        const worn_gear_summary &worn_summary() const;
+
         struct reason_weight_list melee_miss_reasons;
 
         int id; // A unique ID number, assigned by the game class private so it cannot be overwritten and cause save game corruptions.
@@ -2,18 +2,43 @@
 #include "rng.h"
 #include <stdlib.h>
 
+// The innermost rng_seed_scope of this thread, numbers come from rand() if there is none.
+static thread_local rng_seed_scope *current_scope = nullptr;
+
+rng_seed_scope::rng_seed_scope( unsigned seed )
+    : engine( seed )
+    , previous( current_scope )
+{
+    current_scope = this;
+}
+
+rng_seed_scope::~rng_seed_scope()
+{
+    current_scope = previous;
+}
+
+// Uniformly distributed in [0, 1).
+double rng_fraction()
+{
+    if( current_scope == nullptr ) {
+        return double(rand() / double(RAND_MAX + 1.0));
+    }
+    std::minstd_rand &engine = current_scope->engine;
+    return double(engine() - engine.min()) / (double(engine.max() - engine.min()) + 1.0);
+}
+
 long rng(long val1, long val2)
 {
     long minVal = (val1 < val2) ? val1 : val2;
     long maxVal = (val1 < val2) ? val2 : val1;
-    return minVal + long((maxVal - minVal + 1) * double(rand() / double(RAND_MAX + 1.0)));
+    return minVal + long((maxVal - minVal + 1) * rng_fraction());
 }
 
 double rng_float(double val1, double val2)
 {
     double minVal = (val1 < val2) ? val1 : val2;
     double maxVal = (val1 < val2) ? val2 : val1;
-    return minVal + (maxVal - minVal) * double(rand()) / double(RAND_MAX + 1.0);
+    return minVal + (maxVal - minVal) * rng_fraction();
 }
 
 bool one_in(int chance)
@@ -29,6 +54,9 @@ bool one_in_improved(double chance)
 
 bool x_in_y(double x, double y)
 {
+    if( current_scope != nullptr ) {
+        return rng_fraction() <= x / y;
+    }
     return ((double)rand() / RAND_MAX) <= ((double)x / y);
 }
 
@@ -1,6 +1,8 @@
 #ifndef RNG_H
 #define RNG_H
 
+#include <random>
+
 long rng(long val1, long val2);
 double rng_float(double val1, double val2);
 bool one_in(int chance);
@@ -10,4 +12,25 @@ int dice(int number, int sides);
 
 int djb2_hash(const unsigned char *input);
 
+/**
+ * While an object of this class exists, the functions above draw their numbers on the thread
+ * that created it from a generator seeded with the given seed, instead of from rand().
+ * The numbers only depend on the seed, which makes the result of e.g. overmap generation
+ * independent of anything else going on in the game and allows it to run on another thread.
+ * Scopes can be nested, the outer generator is used again when the inner scope ends.
+ */
+class rng_seed_scope
+{
+    public:
+        rng_seed_scope( unsigned seed );
+        ~rng_seed_scope();
+        rng_seed_scope( const rng_seed_scope & ) = delete;
+        rng_seed_scope &operator=( const rng_seed_scope & ) = delete;
+    private:
+        std::minstd_rand engine;
+        rng_seed_scope *previous;
+
+        friend double rng_fraction();
+};
+
 #endif
@@ -25,6 +25,7 @@
 #include <sstream>
 #include <math.h>
 #include <vector>
+#include <limits>
 #include "debug.h"
 #include "weather.h"
 #include "mapsharing.h"
@@ -71,6 +72,7 @@ void game::serialize(std::ofstream & fout) {
         fout << "# version " << savegame_version << std::endl;
 
         JsonOut json(fout, true); // pretty-print
+        json.reserve_buffer();
 
         json.start_object();
         // basic game state information.
@@ -306,6 +308,238 @@ void game::save_weather(std::ofstream & fout) {
     fout << "seed: " << weatherSeed;
 }
 ///// overmap
+/*
+ * The terrain and monster groups and the seen / explored flags of all layers of an overmap are
+ * stored in binary files next to the text files (same name plus ".bin"), the text files contain
+ * a "B <version>" record if they have one. Older text files have "L" / "E" / "Z" records
+ * instead, those are still loaded.
+ * All numbers in the binary files are LEB128 varints, signed ones zigzag encoded:
+ * - a magic string, the format version and the number of layers,
+ * - terrain file: the number of terrain ids, each id as its length and characters, then for
+ *   each layer the number of runs and (index into the terrain ids, length) of each run.
+ *   Then the number of monster group types, each as its length and characters, the number
+ *   of monster groups and for each: index into the types, x, y, z (signed), radius,
+ *   population, flags (diffuse 1, dying 2, horde 4), target x, y and interest (signed).
+ * - seen file: for each layer the visible and the explored flags, each as the number of runs,
+ *   the value of the first run and the lengths of the runs (the value alternates).
+ * Runs go through the tiles of a layer row by row.
+ */
+static const int overmap_layers_version = 1;
+static const std::string overmap_terrain_magic = "CDDAOMT";
+static const std::string overmap_seen_magic = "CDDAOMS";
+
+static void write_varint( std::string &out, unsigned value )
+{
+    while( value >= 0x80 ) {
+        out += static_cast<char>( ( value & 0x7f ) | 0x80 );
+        value >>= 7;
+    }
+    out += static_cast<char>( value );
+}
+
+static void write_signed_varint( std::string &out, const int value )
+{
+    write_varint( out, ( static_cast<unsigned>( value ) << 1 ) ^ static_cast<unsigned>( value >> 31 ) );
+}
+
+static void write_string( std::string &out, const std::string &str )
+{
+    write_varint( out, str.size() );
+    out += str;
+}
+
+static void write_flag_layer( std::string &out, const bool ( &flags )[OMAPX][OMAPY] )
+{
+    std::vector<unsigned> runs;
+    bool current = flags[0][0];
+    unsigned count = 0;
+    for( int j = 0; j < OMAPY; j++ ) {
+        for( int i = 0; i < OMAPX; i++ ) {
+            if( flags[i][j] != current ) {
+                runs.push_back( count );
+                current = flags[i][j];
+                count = 0;
+            }
+            count++;
+        }
+    }
+    runs.push_back( count );
+    write_varint( out, runs.size() );
+    write_varint( out, flags[0][0] ? 1 : 0 );
+    for( const unsigned run : runs ) {
+        write_varint( out, run );
+    }
+}
+
+// Reads the binary layer files, throws a std::string if the data is truncated or invalid.
+class overmap_layer_reader
+{
+    public:
+        overmap_layer_reader( const std::string &filename ) : filename( filename ), pos( 0 ) {
+            std::ifstream fin( filename.c_str(), std::ios::in | std::ios::binary );
+            if( !fin.is_open() ) {
+                throw filename + ": can not open file";
+            }
+            std::ostringstream buffer;
+            buffer << fin.rdbuf();
+            data = buffer.str();
+        }
+        void check_header( const std::string &magic ) {
+            if( data.compare( 0, magic.size(), magic ) != 0 ) {
+                throw filename + ": not an overmap layer file";
+            }
+            pos = magic.size();
+            const unsigned version = varint();
+            if( version != overmap_layers_version ) {
+                throw string_format( "%s: unsupported version %u", filename.c_str(), version );
+            }
+            const unsigned layers = varint();
+            if( layers != OVERMAP_LAYERS ) {
+                throw string_format( "%s: has %u layers instead of %d", filename.c_str(), layers,
+                                     OVERMAP_LAYERS );
+            }
+        }
+        unsigned varint() {
+            unsigned value = 0;
+            for( int shift = 0; shift < 32; shift += 7 ) {
+                if( pos >= data.size() ) {
+                    throw filename + ": unexpected end of file";
+                }
+                const unsigned char byte = data[pos++];
+                value |= static_cast<unsigned>( byte & 0x7f ) << shift;
+                if( ( byte & 0x80 ) == 0 ) {
+                    return value;
+                }
+            }
+            throw filename + ": invalid number";
+        }
+        int signed_varint() {
+            const unsigned value = varint();
+            return static_cast<int>( value >> 1 ) ^ -static_cast<int>( value & 1 );
+        }
+        std::string str() {
+            const unsigned length = varint();
+            if( length > data.size() - pos ) {
+                throw filename + ": unexpected end of file";
+            }
+            pos += length;
+            return data.substr( pos - length, length );
+        }
+        /** Reads the number of runs, checks that they cover exactly one layer. */
+        unsigned run_count() {
+            const unsigned runs = varint();
+            if( runs == 0 || runs > OMAPX * OMAPY ) {
+                throw filename + ": invalid number of runs";
+            }
+            return runs;
+        }
+        /** Reads the length of a run starting at tile index start of a layer. */
+        unsigned run_length( const unsigned start ) {
+            const unsigned length = varint();
+            if( length == 0 || length > OMAPX * OMAPY - start ) {
+                throw filename + ": invalid run length";
+            }
+            return length;
+        }
+        void read_flag_layer( bool ( &flags )[OMAPX][OMAPY] ) {
+            const unsigned runs = run_count();
+            bool value = varint() != 0;
+            unsigned tile = 0;
+            for( unsigned r = 0; r < runs; r++, value = !value ) {
+                const unsigned length = run_length( tile );
+                for( const unsigned end = tile + length; tile < end; tile++ ) {
+                    flags[tile % OMAPX][tile / OMAPX] = value;
+                }
+            }
+            if( tile != OMAPX * OMAPY ) {
+                throw filename + ": layer is incomplete";
+            }
+        }
+    private:
+        std::string filename;
+        std::string data;
+        size_t pos;
+};
+
+// Terrain ids as they are found in save files, including renamed ones.
+static oter_id oter_from_save( const std::string &tmp_ter, std::string const &terfilename )
+{
+    if( otermap.count( tmp_ter ) > 0 ) {
+        return oter_id( tmp_ter );
+    } else if( tmp_ter.compare( 0, 7, "mall_a_" ) == 0 &&
+               otermap.count( tmp_ter + "_north" ) > 0 ) {
+        return oter_id( tmp_ter + "_north" );
+    } else if( tmp_ter.compare( 0, 13, "necropolis_a_" ) == 0 &&
+               otermap.count( tmp_ter + "_north" ) > 0 ) {
+        return oter_id( tmp_ter + "_north" );
+    }
+    debugmsg("Loaded bad ter!  %s; ter %s", terfilename.c_str(), tmp_ter.c_str());
+    return oter_id( 0 );
+}
+
+void overmap::unserialize_terrain_layers( std::string const &filename )
+{
+    overmap_layer_reader reader( filename );
+    reader.check_header( overmap_terrain_magic );
+    std::vector<oter_id> ids( reader.varint() );
+    for( auto &id : ids ) {
+        id = oter_from_save( reader.str(), filename );
+    }
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        const unsigned runs = reader.run_count();
+        unsigned tile = 0;
+        for( unsigned r = 0; r < runs; r++ ) {
+            const unsigned index = reader.varint();
+            if( index >= ids.size() ) {
+                throw filename + ": invalid terrain index";
+            }
+            const oter_id id = ids[index];
+            const unsigned length = reader.run_length( tile );
+            for( const unsigned end = tile + length; tile < end; tile++ ) {
+                layer[z].terrain[tile % OMAPX][tile / OMAPX] = id;
+            }
+        }
+        if( tile != OMAPX * OMAPY ) {
+            throw filename + ": layer is incomplete";
+        }
+    }
+
+    std::vector<std::string> group_types( reader.varint() );
+    for( auto &type : group_types ) {
+        type = reader.str();
+    }
+    for( unsigned groups = reader.varint(); groups > 0; groups-- ) {
+        const unsigned type = reader.varint();
+        if( type >= group_types.size() ) {
+            throw filename + ": invalid monster group type";
+        }
+        const int x = reader.signed_varint();
+        const int y = reader.signed_varint();
+        const int z = reader.signed_varint();
+        const unsigned radius = reader.varint();
+        mongroup mg( group_types[type], x, y, z, radius, reader.varint() );
+        const unsigned flags = reader.varint();
+        mg.diffuse = ( flags & 1 ) != 0;
+        mg.dying = ( flags & 2 ) != 0;
+        mg.horde = ( flags & 4 ) != 0;
+        const int tx = reader.signed_varint();
+        const int ty = reader.signed_varint();
+        mg.set_target( tx, ty );
+        mg.interest = reader.signed_varint();
+        add_mon_group( mg );
+    }
+}
+
+void overmap::unserialize_seen_layers( std::string const &filename )
+{
+    overmap_layer_reader reader( filename );
+    reader.check_header( overmap_seen_magic );
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        reader.read_flag_layer( layer[z].visible );
+        reader.read_flag_layer( layer[z].explored );
+    }
+}
+
 void overmap::unserialize(std::ifstream & fin, std::string const & plrfilename,
                           std::string const & terfilename) {
     // DEBUG VARS
@@ -346,18 +580,7 @@ void overmap::unserialize(std::ifstream & fin, std::string const & plrfilename,
                     for (int i = 0; i < OMAPX; i++) {
                         if (count == 0) {
                             fin >> tmp_ter >> count;
-                            if( otermap.count( tmp_ter ) > 0 ) {
-                                tmp_otid = tmp_ter;
-                            } else if( tmp_ter.compare( 0, 7, "mall_a_" ) == 0 &&
-                                       otermap.count( tmp_ter + "_north" ) > 0 ) {
-                                tmp_otid = tmp_ter + "_north";
-                            } else if( tmp_ter.compare( 0, 13, "necropolis_a_" ) == 0 &&
-                                       otermap.count( tmp_ter + "_north" ) > 0 ) {
-                                tmp_otid = tmp_ter + "_north";
-                            } else {
-                                debugmsg("Loaded bad ter!  %s; ter %s", terfilename.c_str(), tmp_ter.c_str());
-                                tmp_otid = 0;
-                            }
+                            tmp_otid = oter_from_save( tmp_ter, terfilename );
                         }
                         count--;
                         layer[z].terrain[i][j] = tmp_otid; //otermap[tmp_ter].loadid;
@@ -367,6 +590,18 @@ void overmap::unserialize(std::ifstream & fin, std::string const & plrfilename,
             } else {
                 debugmsg("Loaded z level out of range (z: %d)", z);
             }
+        } else if (datatype == 'B') { // Layers are in the binary file
+            int version;
+            fin >> version;
+            if( version != overmap_layers_version ) {
+                debugmsg( "%s: unsupported overmap layer version %d", terfilename.c_str(), version );
+                continue;
+            }
+            try {
+                unserialize_terrain_layers( terfilename + ".bin" );
+            } catch( std::string &err ) {
+                debugmsg( "Failed to load overmap terrain: %s", err.c_str() );
+            }
         } else if (datatype == 'Z') { // Monster group
             // save compatiblity hack: read the line, initialze new members to 0,
             // "parse" line,
@@ -416,6 +651,8 @@ void overmap::unserialize(std::ifstream & fin, std::string const & plrfilename,
             tmp.type = (radio_type)tmp_type;
             getline(fin, tmp.message); // Chomp endl
             getline(fin, tmp.message);
+            // The frequency isn't saved, the tower gets a new one.
+            tmp.frequency = rand();
             radios.push_back(tmp);
         } else if ( datatype == 'v' ) {
             om_vehicle v;
@@ -507,9 +744,9 @@ void overmap::unserialize(std::ifstream & fin, std::string const & plrfilename,
     std::ifstream sfin;
     // Private/per-character data
     sfin.open(plrfilename.c_str());
-    if ( fin.peek() == '#' ) { // not handling muilti-version seen cache
+    if ( sfin.peek() == '#' ) { // not handling muilti-version seen cache
         std::string vline;
-        getline(fin, vline);
+        getline(sfin, vline);
     }
     if (sfin.is_open()) { // Load private seen data
         int z = 0; // assumption
@@ -552,6 +789,26 @@ void overmap::unserialize(std::ifstream & fin, std::string const & plrfilename,
                         }
                     }
                 }
+            } else if (datatype == 'B') { // Layers are in the binary file
+                int version;
+                sfin >> version;
+                if( version != overmap_layers_version ) {
+                    debugmsg( "%s: unsupported overmap layer version %d", plrfilename.c_str(), version );
+                    continue;
+                }
+                try {
+                    unserialize_seen_layers( plrfilename + ".bin" );
+                } catch( std::string &err ) {
+                    debugmsg( "Failed to load overmap seen data: %s", err.c_str() );
+                }
+            } else if (datatype == 'n') { // Load notes of the given layer
+                om_note tmp;
+                sfin >> z >> tmp.x >> tmp.y;
+                getline(sfin, tmp.text); // Chomp endl
+                getline(sfin, tmp.text);
+                if (z >= 0 && z < OVERMAP_LAYERS) {
+                    layer[z].notes.push_back(tmp);
+                }
             } else if (datatype == 'N') { // Load notes
                 om_note tmp;
                 sfin >> tmp.x >> tmp.y;
@@ -578,90 +835,111 @@ void overmap::save() const
     fout.open(plrfilename.c_str());
 
     fout << "# version " << savegame_version << std::endl;
+    fout << "B " << overmap_layers_version << std::endl;
 
     for (int z = 0; z < OVERMAP_LAYERS; ++z) {
-        fout << "L " << z << std::endl;
-        int count = 0;
-        int lastvis = -1;
-        int lastexp = -1;
-        for (int j = 0; j < OMAPY; j++) {
-            for (int i = 0; i < OMAPX; i++) {
-                int v = (layer[z].visible[i][j] ? 1 : 0);
-                if (v != lastvis) {
-                    if (count) {
-                        fout << count << " ";
-                    }
-                    lastvis = v;
-                    fout << v << " ";
-                    count = 1;
-                } else {
-                    count++;
-                }
-            }
+        for (auto &i : layer[z].notes) {
+            fout << "n " << z << " " << i.x << " " << i.y << " " << std::endl << i.text << std::endl;
         }
-        fout << count;
-        fout << std::endl;
-
-        //So we don't break saves that don't have this data, we add a new type.
-        fout << "E " << z << std::endl;
-        count = 0;
-
-        for (int j = 0; j < OMAPY; j++) {
-            for (int i = 0; i < OMAPX; i++) {
-                int e = (layer[z].explored[i][j] ? 1 : 0);
-                if (e != lastexp) {
-                    if (count) {
-                        fout << count << " ";
-                    }
-                    lastexp = e;
-                    fout << e << " ";
-                    count = 1;
+    }
+    fout.close();
+
+    std::string seen = overmap_seen_magic;
+    write_varint( seen, overmap_layers_version );
+    write_varint( seen, OVERMAP_LAYERS );
+    for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
+        write_flag_layer( seen, layer[z].visible );
+        write_flag_layer( seen, layer[z].explored );
+    }
+    fout.open( ( plrfilename + ".bin" ).c_str(), std::ios::out | std::ios::trunc | std::ios::binary );
+    fout.write( seen.data(), seen.size() );
+    fout.close();
+
+    // World terrain data, the runs of all layers are collected first to get the table of
+    // terrain ids that precedes them.
+    std::vector<std::string> ids;
+    // Index of each oter_id (by its numeric value) in ids, not_indexed if it's not in there yet.
+    const unsigned not_indexed = std::numeric_limits<unsigned>::max();
+    std::vector<unsigned> id_index( oterlist.size(), not_indexed );
+    std::string runs;
+    for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
+        std::vector<std::pair<unsigned, unsigned>> layer_runs;
+        for( int j = 0; j < OMAPY; j++ ) {
+            for( int i = 0; i < OMAPX; i++ ) {
+                const oter_id t = layer[z].terrain[i][j];
+                unsigned &index = id_index[t._val];
+                if( index == not_indexed ) {
+                    index = ids.size();
+                    ids.push_back( std::string( t ) );
+                }
+                if( !layer_runs.empty() && layer_runs.back().first == index ) {
+                    layer_runs.back().second++;
                 } else {
-                    count++;
+                    layer_runs.push_back( std::make_pair( index, 1 ) );
                 }
             }
         }
-        fout << count;
-        fout << std::endl;
+        write_varint( runs, layer_runs.size() );
+        for( const auto &run : layer_runs ) {
+            write_varint( runs, run.first );
+            write_varint( runs, run.second );
+        }
+    }
+    std::string terrain = overmap_terrain_magic;
+    write_varint( terrain, overmap_layers_version );
+    write_varint( terrain, OVERMAP_LAYERS );
+    write_varint( terrain, ids.size() );
+    for( const auto &id : ids ) {
+        write_string( terrain, id );
+    }
+    terrain += runs;
 
-        for (auto &i : layer[z].notes) {
-            fout << "N " << i.x << " " << i.y << " " << std::endl << i.text << std::endl;
+    std::vector<std::string> group_types;
+    std::map<std::string, unsigned> group_type_index;
+    std::string groups;
+    write_varint( groups, zg.size() );
+    for( auto &mgv : zg ) {
+        const mongroup &mg = mgv.second;
+        const auto inserted = group_type_index.insert( std::make_pair( mg.type, group_types.size() ) );
+        if( inserted.second ) {
+            group_types.push_back( mg.type );
         }
+        write_varint( groups, inserted.first->second );
+        write_signed_varint( groups, mg.posx );
+        write_signed_varint( groups, mg.posy );
+        write_signed_varint( groups, mg.posz );
+        write_varint( groups, mg.radius );
+        write_varint( groups, mg.population );
+        write_varint( groups, ( mg.diffuse ? 1 : 0 ) | ( mg.dying ? 2 : 0 ) | ( mg.horde ? 4 : 0 ) );
+        write_signed_varint( groups, mg.tx );
+        write_signed_varint( groups, mg.ty );
+        write_signed_varint( groups, mg.interest );
     }
-    fout.close();
+    write_varint( terrain, group_types.size() );
+    for( const auto &type : group_types ) {
+        write_string( terrain, type );
+    }
+    terrain += groups;
+    const std::string terbinfilename = terfilename + ".bin";
+    fopen_exclusive( fout, terbinfilename.c_str(),
+                     std::ios_base::out | std::ios_base::trunc | std::ios_base::binary );
+    if( !fout.is_open() ) {
+        return;
+    }
+    fout.write( terrain.data(), terrain.size() );
+    fclose_exclusive( fout, terbinfilename.c_str() );
 
-    // World terrain data
     fopen_exclusive(fout, terfilename.c_str(), std::ios_base::trunc);
     if(!fout.is_open()) {
         return;
     }
     fout << "# version " << savegame_version << std::endl;
-    for (int z = 0; z < OVERMAP_LAYERS; ++z) {
-        fout << "L " << z << std::endl;
-        int count = 0;
-        oter_id last_tertype(-1);
-        for (int j = 0; j < OMAPY; j++) {
-            for (int i = 0; i < OMAPX; i++) {
-                oter_id t = layer[z].terrain[i][j];
-                if (t != last_tertype) {
-                    if (count) {
-                        fout << count << " ";
-                    }
-                    last_tertype = t;
-                    fout << std::string(t) << " ";
-                    count = 1;
-                } else {
-                    count++;
-                }
-            }
-        }
-        fout << count;
-        fout << std::endl;
-    }
+    fout << "B " << overmap_layers_version << std::endl;
 
     try {
         fout << "! ";
         JsonOut json(fout, false);
+        json.reserve_buffer();
         json.start_object();
         json.member("region_id", settings.id); // temporary, to allow user to manually switch regions during play until regionmap is done.
         json.end_object();
@@ -670,13 +948,6 @@ void overmap::save() const
     }
     fout << std::endl;
 
-    for( auto &mgv : zg ) {
-        auto &mg = mgv.second;
-        fout << "Z " << mg.type << " " << mg.posx << " " << mg.posy << " " <<
-            mg.posz << " " << int(mg.radius) << " " << mg.population << " " <<
-            mg.diffuse << " " << mg.dying << " " <<
-            mg.horde << " " << mg.tx << " " << mg.ty << " " << mg.interest << std::endl;
-    }
     for (auto &i : cities)
         fout << "t " << i.x << " " << i.y << " " << i.s << std::endl;
     for (auto &i : roads_out)
@@ -730,6 +1001,8 @@ void game::unserialize_master(std::ifstream &fin) {
            popup_nowait(_("Cannot find loader for save data in old version %d, attempting to load as current version %d."),savegame_loading_version, savegame_version);
        }
    }
+    // Worlds from before the seed was saved get a new one.
+    overmap_buffer.set_seed( rand() );
     try {
         // single-pass parsing example
         JsonIn jsin(fin);
@@ -742,6 +1015,8 @@ void game::unserialize_master(std::ifstream &fin) {
                 next_faction_id = jsin.get_int();
             } else if (name == "next_npc_id") {
                 next_npc_id = jsin.get_int();
+            } else if (name == "overmap_seed") {
+                overmap_buffer.set_seed( jsin.get_int() );
             } else if (name == "active_missions") {
                 mission::unserialize_all( jsin );
             } else if (name == "factions") {
@@ -774,11 +1049,13 @@ void game::serialize_master(std::ofstream &fout) {
     fout << "# version " << savegame_version << std::endl;
     try {
         JsonOut json(fout, true); // pretty-print
+        json.reserve_buffer();
         json.start_object();
 
         json.member("next_mission_id", next_mission_id);
         json.member("next_faction_id", next_faction_id);
         json.member("next_npc_id", next_npc_id);
+        json.member("overmap_seed", overmap_buffer.get_seed());
 
         json.member("active_missions");
         mission::serialize_all( json );
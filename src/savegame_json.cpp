@@ -172,6 +172,7 @@ void Character::load(JsonObject &data)
             my_mutations.erase( it++ );
         }
     }
+    update_trait_bits();
 
     data.read( "my_bionics", my_bionics );
 
@@ -1139,7 +1140,7 @@ void item::deserialize(JsonObject &data)
     std::set<std::string> members = pvars.get_member_names();
     for( const auto &member : members ) {
         if( pvars.has_string( member ) ) {
-            item_vars[member] = pvars.get_string( member );
+            edit_item_vars()[member] = pvars.get_string( member );
         }
     }
 
@@ -1150,8 +1151,10 @@ void item::deserialize(JsonObject &data)
     }
     make(idtmp);
 
-    if ( ! data.read( "name", name ) ) {
-        name = type_name(1);
+    // Older saves have the type name here for all kinds of items, only corpses need it.
+    std::string corpse_name;
+    if( data.read( "name", corpse_name ) && !corpse_name.empty() && typeId() == "corpse" ) {
+        extra.ensure().corpse_name = corpse_name;
     }
     // Compatiblity for item type changes: for example soap changed from being a generic item
     // (item::charges == -1) to comestible (and thereby counted by charges), old saves still have
@@ -1213,7 +1216,11 @@ void item::deserialize(JsonObject &data)
     }
 
     data.read("contents", contents);
-    data.read("components", components);
+    t_item_vector components;
+    data.read( "components", components );
+    if( !components.empty() ) {
+        edit_components() = std::move( components );
+    }
 }
 
 void item::serialize(JsonOut &json, bool save_contents) const
@@ -1280,12 +1287,12 @@ void item::serialize(JsonOut &json, bool save_contents) const
         json.member( "item_tags", item_tags );
     }
 
-    if ( ! item_vars.empty() ) {
-        json.member( "item_vars", item_vars );
+    if ( ! get_item_vars().empty() ) {
+        json.member( "item_vars", get_item_vars() );
     }
 
-    if ( name != type_name(1) ) {
-        json.member( "name", name );
+    if ( ! corpse_name().empty() ) {
+        json.member( "name", corpse_name() );
     }
 
     if ( light.luminance != 0 ) {
@@ -1309,7 +1316,9 @@ void item::serialize(JsonOut &json, bool save_contents) const
         json.end_array();
     }
 
-    json.member( "components", components );
+    if( !get_components().empty() ) {
+        json.member( "components", get_components() );
+    }
 
     json.end_object();
 }
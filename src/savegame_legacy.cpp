@@ -903,6 +903,8 @@ bool overmap::unserialize_legacy(std::ifstream & fin, std::string const & plrfil
                     tmp.type = (radio_type)tmp_type;
                     getline(fin, tmp.message); // Chomp endl
                     getline(fin, tmp.message);
+                    // The frequency isn't saved, the tower gets a new one.
+                    tmp.frequency = rand();
                     radios.push_back(tmp);
                 } else if (datatype == 'n') { // NPC
                     // When we start loading a new NPC, check to see if we've
@@ -1102,9 +1104,9 @@ static bool unserialize_legacy(std::ifstream & fin ) {
             int tmpter;
             fin >> tmpter;
             tmpter = ter_key[tmpter];
-            sm->ter[i][j] = ter_id(tmpter);
+            sm->set_ter( i, j, ter_id(tmpter) );
             sm->set_furn(i, j, f_null);
-            sm->itm[i][j].clear();
+            sm->get_items( i, j ).clear();
             sm->set_trap(i, j, tr_null);
            }
           }
@@ -1137,15 +1139,15 @@ static bool unserialize_legacy(std::ifstream & fin ) {
             if( it_tmp.is_emissive() ) {
                 sm->update_lum_add(it_tmp, itx, ity);
             }
-            sm->itm[itx][ity].push_back(it_tmp);
+            sm->get_items( itx, ity ).push_back(it_tmp);
             if( it_tmp.active ) {
-                sm->active_items.add( std::prev(sm->itm[itx][ity].end()), point( itx, ity ) );
+                sm->active_items.add( std::prev(sm->get_items( itx, ity ).end()), point( itx, ity ) );
             }
            } else if (string_identifier == "C") {
             getline(fin, databuff); // Clear out the endline
             getline(fin, databuff);
             it_tmp.load_info(databuff);
-            sm->itm[itx][ity].back().put_in(it_tmp);
+            sm->get_items( itx, ity ).back().put_in(it_tmp);
            } else if (string_identifier == "T") {
             fin >> itx >> ity >> t;
             sm->set_trap(itx, ity, trap_id(t));
@@ -1154,9 +1156,9 @@ static bool unserialize_legacy(std::ifstream & fin ) {
             sm->set_furn(itx, ity, furn_id(furn_key[t]));
            } else if (string_identifier == "F") {
             fin >> itx >> ity >> t >> d >> a;
-            if(!sm->fld[itx][ity].findField(field_id(t)))
+            if(!sm->get_field( itx, ity ).findField(field_id(t)))
              sm->field_count++;
-            sm->fld[itx][ity].addField(field_id(t), d, a);
+            sm->get_field( itx, ity ).addField(field_id(t), d, a);
            } else if (string_identifier == "S") {
             char tmpfriend;
             int tmpfac = -1, tmpmis = -1;
@@ -1174,10 +1176,12 @@ static bool unserialize_legacy(std::ifstream & fin ) {
             sm->vehicles.push_back(veh);
            } else if (string_identifier == "c") {
             getline(fin, databuff);
-            sm->comp.load_data(databuff);
+            sm->comp.reset( new computer() );
+            sm->comp->load_data(databuff);
            } else if (string_identifier == "B") {
             getline(fin, databuff);
-            sm->camp.load_data(databuff);
+            sm->camp.reset( new basecamp() );
+            sm->camp->load_data(databuff);
            } else if (string_identifier == "G") {
              std::string s;
             int j;
@@ -1362,11 +1366,11 @@ static void unserialize_legacy_submaps( std::ifstream &fin, const int num_submap
                 int tmpter;
                 fin >> tmpter;
                 tmpter = ter_key[tmpter];
-                sm->ter[i][j] = ter_id(tmpter);
+                sm->set_ter( i, j, ter_id(tmpter) );
 
                 sm->set_furn(i, j, f_null);
-                sm->itm[i][j].clear();
-                sm->lum[i][j] = 0;
+                sm->get_items( i, j ).clear();
+                sm->set_lum( i, j, 0 );
                 sm->set_trap(i, j, tr_null);
             }
         }
@@ -1413,15 +1417,15 @@ static void unserialize_legacy_submaps( std::ifstream &fin, const int num_submap
                 if (it_tmp.is_emissive()) {
                     sm->update_lum_add(it_tmp, itx, ity);
                 }
-                sm->itm[itx][ity].push_back(it_tmp);
+                sm->get_items( itx, ity ).push_back(it_tmp);
                 if (it_tmp.active) {
-                    sm->active_items.add( std::prev(sm->itm[itx][ity].end()), point( itx, ity ) );
+                    sm->active_items.add( std::prev(sm->get_items( itx, ity ).end()), point( itx, ity ) );
                 }
             } else if (string_identifier == "C") {
                 getline(fin, databuff); // Clear out the endline
                 getline(fin, databuff);
                 it_tmp.load_info(databuff);
-                sm->itm[itx][ity].back().put_in(it_tmp);
+                sm->get_items( itx, ity ).back().put_in(it_tmp);
             } else if (string_identifier == "T") {
                 fin >> itx >> ity >> t;
                 sm->set_trap(itx, ity, trap_id(trap_key[t]));
@@ -1430,10 +1434,10 @@ static void unserialize_legacy_submaps( std::ifstream &fin, const int num_submap
                 sm->set_furn(itx, ity, furn_id(furn_key[t]));
             } else if (string_identifier == "F") {
                 fin >> itx >> ity >> t >> d >> a;
-                if(!sm->fld[itx][ity].findField(field_id(t))) {
+                if(!sm->get_field( itx, ity ).findField(field_id(t))) {
                     sm->field_count++;
                 }
-                sm->fld[itx][ity].addField(field_id(t), d, a);
+                sm->get_field( itx, ity ).addField(field_id(t), d, a);
             } else if (string_identifier == "S") {
                 char tmpfriend;
                 int tmpfac = -1, tmpmis = -1;
@@ -1448,10 +1452,12 @@ static void unserialize_legacy_submaps( std::ifstream &fin, const int num_submap
                 sm->vehicles.push_back(veh);
             } else if (string_identifier == "c") {
                 getline(fin, databuff);
-                sm->comp.load_data(databuff);
+                sm->comp.reset( new computer() );
+                sm->comp->load_data(databuff);
             } else if (string_identifier == "B") {
                 getline(fin, databuff);
-                sm->camp.load_data(databuff);
+                sm->camp.reset( new basecamp() );
+                sm->camp->load_data(databuff);
             } else if (string_identifier == "G") {
                 std::string s;
                 int j;
@@ -1582,6 +1588,7 @@ void player::load_legacy(std::stringstream & dump)
         my_mutations[sTemp]; // Creates a new entry with default values
     }
  }
+ update_trait_bits();
 
  set_highest_cat_level();
  drench_mut_calc();
@@ -1937,7 +1944,12 @@ void item::load_legacy(std::stringstream & dump) {
     for( int i = 0; i < tag_count; ++i )
     {
         dump >> item_tag;
-        if( itag2ivar(item_tag, item_vars ) == false ) {
+        std::map<std::string, std::string> tag_vars;
+        if( itag2ivar( item_tag, tag_vars ) ) {
+            for( const auto &var : tag_vars ) {
+                edit_item_vars()[var.first] = var.second;
+            }
+        } else {
             item_tags.insert( item_tag );
         }
     }
@@ -1948,6 +1960,7 @@ void item::load_legacy(std::stringstream & dump) {
         corpse = GetMType(legacy_mon_id[corp]);
     else
         corpse = NULL;
+    std::string name;
     getline(dump, name);
     if (name == " ''")
         name = "";
@@ -1959,6 +1972,9 @@ void item::load_legacy(std::stringstream & dump) {
         }
         name = name.substr(2, name.size() - 3); // s/^ '(.*)'$/\1/
     }
+    if( !name.empty() && idtmp == "corpse" ) {
+        extra.ensure().corpse_name = name;
+    }
     set_gun_mode( mode );
 
     if( idtmp == "UPS_on" ) {
@@ -0,0 +1,176 @@
+#include "turn_profiler.h"
+#include "json.h"
+#include "debug.h"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <cstdio>
+
+namespace {
+struct phase_record {
+    turn_profiler::phase_totals totals;
+    // Ring buffer of the durations (in seconds) of the last ROLLING_WINDOW calls.
+    double recent[turn_profiler::ROLLING_WINDOW] = {};
+    int next = 0;
+    int filled = 0;
+};
+}
+
+static phase_record phase_data[turn_profiler::NUM_TURN_PHASES];
+static int log_interval = 0;
+static int turns_since_log = 0;
+
+const char *turn_profiler::phase_name( phase p )
+{
+    switch( p ) {
+        case TP_TURN:
+            return "do_turn";
+        case TP_WEATHER:
+            return "update_weather";
+        case TP_ACTIVITY:
+            return "process_activity";
+        case TP_UPDATE_SCENT:
+            return "update_scent";
+        case TP_VEHMOVE:
+            return "vehmove";
+        case TP_VEHICLE_POWER:
+            return "process_vehicle_power";
+        case TP_PROCESS_FIELDS:
+            return "process_fields";
+        case TP_PROCESS_ACTIVE_ITEMS:
+            return "process_active_items";
+        case TP_BUILD_MAP_CACHE:
+            return "build_map_cache";
+        case TP_MONMOVE:
+            return "monmove";
+        case TP_NPCMOVE:
+            return "npcmove";
+        case TP_MAP_SHIFT:
+            return "map_shift";
+        case TP_MAP_LOAD:
+            return "map_load";
+        case TP_MAP_PREGEN:
+            return "map_pregen";
+        case NUM_TURN_PHASES:
+            break;
+    }
+    return "unknown";
+}
+
+const turn_profiler::phase_totals &turn_profiler::totals( phase p )
+{
+    return phase_data[p].totals;
+}
+
+static int histogram_bucket( double seconds )
+{
+    int bucket = 0;
+    for( double limit = 1e-6; bucket < turn_profiler::NUM_HISTOGRAM_BUCKETS - 1 && seconds >= limit;
+         limit *= 2 ) {
+        bucket++;
+    }
+    return bucket;
+}
+
+turn_profiler::phase_stats turn_profiler::stats( phase p )
+{
+    const phase_record &rec = phase_data[p];
+    phase_stats result;
+    result.samples = rec.filled;
+    if( rec.filled == 0 ) {
+        return result;
+    }
+    std::vector<double> sorted( rec.recent, rec.recent + rec.filled );
+    std::sort( sorted.begin(), sorted.end() );
+    double sum = 0.0;
+    for( const double d : sorted ) {
+        sum += d;
+        result.histogram[histogram_bucket( d )]++;
+    }
+    result.mean = sum * 1000.0 / rec.filled;
+    result.median = sorted[rec.filled / 2] * 1000.0;
+    result.p95 = sorted[std::min( rec.filled - 1, rec.filled * 95 / 100 )] * 1000.0;
+    result.max = sorted.back() * 1000.0;
+    return result;
+}
+
+void turn_profiler::add( phase p, double seconds )
+{
+    phase_record &rec = phase_data[p];
+    rec.totals.seconds += seconds;
+    rec.totals.calls++;
+    rec.recent[rec.next] = seconds;
+    rec.next = ( rec.next + 1 ) % ROLLING_WINDOW;
+    rec.filled = std::min( rec.filled + 1, ROLLING_WINDOW );
+
+    if( p == TP_TURN && log_interval > 0 && ++turns_since_log >= log_interval ) {
+        turns_since_log = 0;
+        DebugLog( D_INFO, D_GAME ) << "turn profile:\n" << report_csv();
+    }
+}
+
+void turn_profiler::reset()
+{
+    for( auto &elem : phase_data ) {
+        elem = phase_record();
+    }
+    turns_since_log = 0;
+}
+
+std::string turn_profiler::report_csv()
+{
+    std::ostringstream out;
+    out << "phase,calls,total_ms,samples,mean_ms,median_ms,p95_ms,max_ms\n";
+    char buf[256];
+    for( int i = 0; i < NUM_TURN_PHASES; i++ ) {
+        const phase p = static_cast<phase>( i );
+        const phase_stats s = stats( p );
+        snprintf( buf, sizeof( buf ), "%s,%d,%.3f,%d,%.3f,%.3f,%.3f,%.3f\n", phase_name( p ),
+                  totals( p ).calls, totals( p ).seconds * 1000.0, s.samples, s.mean, s.median, s.p95,
+                  s.max );
+        out << buf;
+    }
+    return out.str();
+}
+
+std::string turn_profiler::report_json()
+{
+    std::ostringstream out;
+    JsonOut json( out );
+    json.start_object();
+    for( int i = 0; i < NUM_TURN_PHASES; i++ ) {
+        const phase p = static_cast<phase>( i );
+        const phase_stats s = stats( p );
+        json.member( phase_name( p ) );
+        json.start_object();
+        json.member( "calls", totals( p ).calls );
+        json.member( "total_ms", totals( p ).seconds * 1000.0 );
+        json.member( "samples", s.samples );
+        json.member( "mean_ms", s.mean );
+        json.member( "median_ms", s.median );
+        json.member( "p95_ms", s.p95 );
+        json.member( "max_ms", s.max );
+        // Upper bounds of the buckets are 1us, 2us, 4us, ...
+        json.member( "histogram_log2_us" );
+        json.start_array();
+        for( const int count : s.histogram ) {
+            json.write( count );
+        }
+        json.end_array();
+        json.end_object();
+    }
+    json.end_object();
+    return out.str();
+}
+
+void turn_profiler::set_log_interval( int turns )
+{
+    log_interval = std::max( turns, 0 );
+    turns_since_log = 0;
+}
+
+int turn_profiler::get_log_interval()
+{
+    return log_interval;
+}
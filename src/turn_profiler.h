@@ -0,0 +1,96 @@
+#ifndef TURN_PROFILER_H
+#define TURN_PROFILER_H
+
+#include <chrono>
+#include <string>
+
+/**
+ * Wall clock time spent in the phases of @ref game::do_turn and in map shifting / loading.
+ * Wrap a phase in a @ref turn_profiler::scoped_timer to have it measured.
+ *
+ * Two kinds of data are kept for each phase: totals since the last reset() (used by the
+ * turn benchmark, tests/turn_benchmark.cpp) and the durations of the last @ref ROLLING_WINDOW
+ * calls, from which the statistics and histograms shown in the debug menu and written to
+ * the debug log are computed.
+ */
+namespace turn_profiler {
+    enum phase : int {
+        TP_TURN = 0,         // all of game::do_turn
+        TP_WEATHER,
+        TP_ACTIVITY,
+        TP_UPDATE_SCENT,
+        TP_VEHMOVE,
+        TP_VEHICLE_POWER,
+        TP_PROCESS_FIELDS,
+        TP_PROCESS_ACTIVE_ITEMS,
+        TP_BUILD_MAP_CACHE,
+        TP_MONMOVE,          // monsters and NPCs
+        TP_NPCMOVE,          // only the NPC part of TP_MONMOVE
+        TP_MAP_SHIFT,
+        TP_MAP_LOAD,
+        TP_MAP_PREGEN,       // generating submaps ahead of the player
+        NUM_TURN_PHASES
+    };
+
+    /** Number of recent calls the rolling statistics are computed from (one hour of turns). */
+    const int ROLLING_WINDOW = 600;
+    /**
+     * Bucket i of the histogram counts the calls that took less than 2^i microseconds
+     * (and at least 2^(i-1)), the last bucket counts everything longer.
+     */
+    const int NUM_HISTOGRAM_BUCKETS = 21;
+
+    struct phase_totals {
+        double seconds = 0.0;
+        int calls = 0;
+    };
+
+    /** Statistics over the rolling window, durations in milliseconds. */
+    struct phase_stats {
+        int samples = 0;
+        double mean = 0.0;
+        double median = 0.0;
+        double p95 = 0.0;
+        double max = 0.0;
+        int histogram[NUM_HISTOGRAM_BUCKETS] = {};
+    };
+
+    /** Short name of the phase, as used in reports. */
+    const char *phase_name( phase p );
+    /** Totals for the phase since the last reset(). */
+    const phase_totals &totals( phase p );
+    phase_stats stats( phase p );
+    void add( phase p, double seconds );
+    /** Clears the totals and the rolling window of all phases. */
+    void reset();
+
+    /** One line per phase with the totals and rolling statistics, with a header line. */
+    std::string report_csv();
+    /** Same as report_csv, but as a JSON object keyed by phase name, including the histograms. */
+    std::string report_json();
+    /**
+     * If turns is positive, the CSV report is written to the debug log after every
+     * that many turns. 0 disables it, which is the default.
+     */
+    void set_log_interval( int turns );
+    int get_log_interval();
+
+    /** Measures the time from its construction to its destruction. */
+    class scoped_timer
+    {
+        public:
+            scoped_timer( phase p ) : which( p ), start( std::chrono::steady_clock::now() ) {}
+            ~scoped_timer()
+            {
+                const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                add( which, elapsed.count() );
+            }
+            scoped_timer( const scoped_timer & ) = delete;
+            scoped_timer &operator=( const scoped_timer & ) = delete;
+        private:
+            phase which;
+            std::chrono::steady_clock::time_point start;
+    };
+}
+
+#endif
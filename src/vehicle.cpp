@@ -2856,7 +2856,7 @@ int vehicle::solar_epower (tripoint sm_loc)
                 continue;
             }
 
-            if( !(terlist[sm->ter[pg.x][pg.y]].has_flag(TFLAG_INDOORS) ||
+            if( !(terlist[sm->get_ter( pg.x, pg.y )].has_flag(TFLAG_INDOORS) ||
                   furnlist[sm->get_furn(pg.x, pg.y)].has_flag(TFLAG_INDOORS)) ) {
                 epower += ( part_epower( elem ) * g->ground_natural_light_level() ) / DAYLIGHT_LEVEL;
             }
@@ -3607,6 +3607,13 @@ void vehicle::idle(bool on_map) {
     }
 }
 
+bool vehicle::needs_idle_processing() const
+{
+    return engine_on || reactor_on || lights_on || overhead_lights_on || tracking_on ||
+           fridge_on || recharger_on || is_alarm_on || camera_on || dome_lights_on ||
+           aisle_lights_on || stereo_on || !solar_panels.empty();
+}
+
 void vehicle::alarm(){
     if (one_in(4)) {
         //first check if the alarm is still installed
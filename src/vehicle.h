@@ -599,6 +599,8 @@ public:
 
 // idle fuel consumption
     void idle (bool on_map = true);
+// whether power_parts and idle have anything to do, i.e. something is running or generating power
+    bool needs_idle_processing () const;
 // continuous processing for running vehicle alarms
     void alarm ();
 // leak from broken tanks
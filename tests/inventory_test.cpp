@@ -0,0 +1,49 @@
+#include <tap++/tap++.h>
+using namespace TAP;
+
+#include "game.h"
+#include "inventory.h"
+#include "item.h"
+#include "options.h"
+#include "path_info.h"
+
+// The inventory caches the totals of its items, but items can be changed through references
+// the inventory has handed out earlier. The totals must follow those changes.
+int main(int argc, char *argv[])
+{
+ plan(7);
+
+ PATH_INFO::init_base_path( "" );
+ PATH_INFO::init_user_dir( "./" );
+ PATH_INFO::set_standard_filenames();
+ initOptions();
+
+ g = new game;
+ g->load_static_data();
+ g->check_all_mod_data();
+
+ inventory inv;
+ item &flashlight = inv.add_item( item( "flashlight", 0, false ) );
+ flashlight.charges = 50;
+ ok( inv.charges_of( "flashlight" ) == 50, "charges changed before the first query" );
+
+ item &held = inv.item_by_type( "flashlight" );
+ ok( inv.charges_of( "flashlight" ) == 50, "charges after handing out a reference" );
+ held.charges = 20;
+ ok( inv.charges_of( "flashlight" ) == 20, "charges changed through a held reference" );
+ held.charges = 0;
+ ok( !inv.has_charges( "flashlight", 1 ), "charges used up through a held reference" );
+
+ ok( inv.amount_of( "flashlight" ) == 1, "amount before replacing the item" );
+ held = item( "lighter", 0, false );
+ ok( inv.amount_of( "flashlight" ) == 0 && inv.amount_of( "lighter" ) == 1,
+     "amounts after replacing the item through a held reference" );
+
+ item &bottle = inv.add_item( item( "bottle_plastic", 0, false ) );
+ inv.charges_of( "water" );
+ bottle.put_in( item( "water", 0, false ) );
+ ok( inv.charges_of( "water" ) == bottle.contents[0].charges,
+     "contents added through a held reference" );
+
+ return 0;
+}
@@ -0,0 +1,204 @@
+// Headless benchmark of game::do_turn.
+//
+// Starts a new game in a fresh world with a fixed seed, sets up one of the
+// canned scenarios around the player and runs a number of turns without any
+// player input, then prints the time spent in each phase of the turn as
+// measured by turn_profiler.
+//
+// Run it from the top level directory so the data files are found:
+//   tests/turn_benchmark [--scenario horde|fire|convoy|base|idle] [--turns N]
+//                        [--seed N] [--userdir path]
+
+#include "game.h"
+#include "player.h"
+#include "map.h"
+#include "monster.h"
+#include "monstergenerator.h"
+#include "vehicle.h"
+#include "item.h"
+#include "field.h"
+#include "options.h"
+#include "path_info.h"
+#include "filesystem.h"
+#include "worldfactory.h"
+#include "mapbuffer.h"
+#include "profession.h"
+#include "scenario.h"
+#include "debug.h"
+#include "rng.h"
+#include "turn_profiler.h"
+#include "overmapbuffer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Monsters in a ring around the player, as if a horde walked into town.
+static void setup_horde( player &u )
+{
+    for( int i = 0; i < 150; i++ ) {
+        monster zed( GetMType( "mon_zombie" ) );
+        const int x = u.posx() + rng( -30, 30 );
+        const int y = u.posy() + rng( -30, 30 );
+        if( rl_dist( x, y, u.posx(), u.posy() ) < 8 || !g->is_empty( x, y ) ) {
+            continue;
+        }
+        zed.spawn( x, y );
+        g->add_zombie( zed );
+    }
+}
+
+// A block of burning tiles next to the player, at night.
+static void setup_fire( player &u )
+{
+    while( !calendar::turn.is_night() ) {
+        calendar::turn += HOURS( 1 );
+    }
+    for( int x = u.posx() + 5; x < u.posx() + 20; x++ ) {
+        for( int y = u.posy() - 7; y < u.posy() + 8; y++ ) {
+            if( g->m.move_cost( x, y ) > 0 ) {
+                g->m.add_field( x, y, fd_fire, 3 );
+            }
+        }
+    }
+}
+
+// Several vehicles with their engines running and all lights on.
+static void setup_convoy( player &u )
+{
+    for( int i = 0; i < 6; i++ ) {
+        vehicle *veh = g->m.add_vehicle( "car", u.posx() - 20 + i * 7, u.posy() + 10, 0, 100, 0 );
+        if( veh == nullptr ) {
+            continue;
+        }
+        veh->engine_on = true;
+        veh->lights_on = true;
+        veh->overhead_lights_on = true;
+    }
+}
+
+// Lots of items that need processing every turn scattered around the player.
+static void setup_base( player &u )
+{
+    static const char *const active_types[] = { "flashlight_on", "candle_lit", "oil_lamp_on", "torch_lit" };
+    for( int i = 0; i < 400; i++ ) {
+        item it( active_types[i % 4], calendar::turn );
+        it.active = true;
+        it.charges = 10000;
+        const int x = u.posx() + rng( -20, 20 );
+        const int y = u.posy() + rng( -20, 20 );
+        if( g->m.move_cost( x, y ) > 0 ) {
+            g->m.add_item_or_charges( x, y, it );
+        }
+    }
+}
+
+static void heal_fully( player &u )
+{
+    for( int i = 0; i < num_hp_parts; i++ ) {
+        u.hp_cur[i] = u.hp_max[i];
+    }
+}
+
+static bool setup_scenario( const std::string &name, player &u )
+{
+    if( name == "horde" ) {
+        setup_horde( u );
+    } else if( name == "fire" ) {
+        setup_fire( u );
+    } else if( name == "convoy" ) {
+        setup_convoy( u );
+    } else if( name == "base" ) {
+        setup_base( u );
+    } else if( name != "idle" ) {
+        return false;
+    }
+    return true;
+}
+
+int main( int argc, char *argv[] )
+{
+    std::string scenario_name = "idle";
+    std::string user_dir = "./benchmark/";
+    int turns = 100;
+    int seed = 42;
+    for( int i = 1; i + 1 < argc; i += 2 ) {
+        if( strcmp( argv[i], "--scenario" ) == 0 ) {
+            scenario_name = argv[i + 1];
+        } else if( strcmp( argv[i], "--turns" ) == 0 ) {
+            turns = atoi( argv[i + 1] );
+        } else if( strcmp( argv[i], "--seed" ) == 0 ) {
+            seed = atoi( argv[i + 1] );
+        } else if( strcmp( argv[i], "--userdir" ) == 0 ) {
+            user_dir = argv[i + 1];
+        }
+    }
+
+    PATH_INFO::init_base_path( "" );
+    PATH_INFO::init_user_dir( user_dir.c_str() );
+    PATH_INFO::set_standard_filenames();
+    if( !assure_dir_exist( FILENAMES["user_dir"] ) || !assure_dir_exist( FILENAMES["savedir"] ) ) {
+        fprintf( stderr, "Can't create %s\n", FILENAMES["savedir"].c_str() );
+        return 1;
+    }
+    setupDebug();
+    initOptions();
+    load_options();
+    // Nothing is displayed, but the game still draws into its curses windows.
+    initscr();
+    init_interface();
+    srand( seed );
+
+    g = new game;
+    g->load_static_data();
+    g->init_ui();
+
+    WORLDPTR world = world_generator->make_new_world( false );
+    if( world == nullptr ) {
+        endwin();
+        fprintf( stderr, "Could not create a world in %s\n", FILENAMES["savedir"].c_str() );
+        return 1;
+    }
+    world_generator->set_active_world( world );
+    g->setup();
+    g->u.name = "Benchmark";
+    g->u.prof = profession::generic();
+    g->scen = scenario::generic();
+    g->u.start_location = g->scen->start_location();
+    // No hunger, thirst or fatigue, so the player never needs to react.
+    g->u.toggle_trait( "DEBUG_LS" );
+    g->u.normalize();
+    heal_fully( g->u );
+    MAPBUFFER.load( world->world_name );
+    g->start_game( world->world_name );
+
+    if( !setup_scenario( scenario_name, g->u ) ) {
+        endwin();
+        fprintf( stderr, "Unknown scenario %s\n", scenario_name.c_str() );
+        return 1;
+    }
+
+    turn_profiler::reset();
+    for( int i = 0; i < turns; i++ ) {
+        // Keep the player out of the input loop of do_turn and alive.
+        g->u.moves = -1000000;
+        heal_fully( g->u );
+        if( g->do_turn() ) {
+            break;
+        }
+    }
+    // Don't leave an overmap generating in the background while the program exits.
+    overmap_buffer.clear();
+    endwin();
+
+    printf( "scenario %s, seed %d, %d turns\n", scenario_name.c_str(), seed, turns );
+    printf( "%-24s %8s %12s %12s\n", "phase", "calls", "total ms", "ms/call" );
+    for( int p = 0; p < turn_profiler::NUM_TURN_PHASES; p++ ) {
+        const auto phase = static_cast<turn_profiler::phase>( p );
+        const auto &totals = turn_profiler::totals( phase );
+        printf( "%-24s %8d %12.3f %12.3f\n", turn_profiler::phase_name( phase ), totals.calls,
+                totals.seconds * 1000.0, totals.calls > 0 ? totals.seconds * 1000.0 / totals.calls : 0.0 );
+    }
+    return 0;
+}